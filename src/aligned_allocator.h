@@ -0,0 +1,83 @@
+#ifndef CONTAINERS_CPP_ALIGNED_ALLOCATOR_H
+#define CONTAINERS_CPP_ALIGNED_ALLOCATOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+#include "growth_policy.h"
+#include "vector.h"
+
+namespace s21 {
+
+// Allocator whose blocks start on an Alignment byte boundary, e.g. 32 for
+// AVX loads, 64 for a cache line or 4096 for a page, and span whole
+// Alignment units: the last line of a block belongs to no other object, so
+// buffers of different threads never share a cache line.
+template <class T, std::size_t Alignment = 64>
+class aligned_allocator {
+  static_assert(Alignment > 0 && (Alignment & (Alignment - 1)) == 0,
+                "s21::aligned_allocator Alignment must be a power of two");
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using is_always_equal = std::true_type;
+
+  template <class U>
+  struct rebind {
+    using other = aligned_allocator<U, Alignment>;
+  };
+
+  static constexpr size_type alignment = std::max(Alignment, alignof(T));
+
+ private:
+  static size_type Bytes(size_type count) {
+    constexpr auto kMaxBytes =
+        static_cast<size_type>(std::numeric_limits<difference_type>::max());
+    if (count > (kMaxBytes - alignment) / sizeof(T))
+      throw std::bad_array_new_length();
+    return (count * sizeof(T) + alignment - 1) & ~(alignment - 1);
+  }
+
+ public:
+  aligned_allocator() noexcept {}
+
+  template <class U>
+  aligned_allocator(const aligned_allocator<U, Alignment> &) noexcept {}
+
+  [[nodiscard]] T *allocate(size_type count) {
+    return static_cast<T *>(
+        ::operator new(Bytes(count), std::align_val_t{alignment}));
+  }
+
+  void deallocate(T *ptr, size_type count) noexcept {
+    ::operator delete(ptr, Bytes(count), std::align_val_t{alignment});
+  }
+
+  template <class U>
+  bool operator==(const aligned_allocator<U, Alignment> &) const noexcept {
+    return true;
+  }
+
+  template <class U>
+  bool operator!=(const aligned_allocator<U, Alignment> &) const noexcept {
+    return false;
+  }
+};
+
+// s21::vector whose data() is Alignment aligned after every reallocation,
+// copy and move, with the capacity padded to whole cache lines, or whole
+// Alignment units if those are larger
+template <class T, std::size_t Alignment = 64>
+using aligned_vector =
+    vector<T, aligned_allocator<T, Alignment>,
+           growth::cache_line_padded<growth::doubling,
+                                     std::max<std::size_t>(Alignment, 64)>>;
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_ALIGNED_ALLOCATOR_H
@@ -0,0 +1,190 @@
+#ifndef CONTAINERS_CPP_ARENA_ALLOCATOR_H
+#define CONTAINERS_CPP_ARENA_ALLOCATOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+namespace s21 {
+
+// Bump-pointer memory resource. Allocations are carved out of chunks
+// obtained from the global heap, deallocation only rewinds the most recent
+// allocation and everything is freed in one shot by release() or the
+// destructor.
+class monotonic_buffer {
+ public:
+  using size_type = std::size_t;
+
+ private:
+  struct Chunk {
+    Chunk *next;
+    size_type size;
+  };
+
+  static constexpr size_type kDefaultChunkSize = 4096;
+  static constexpr size_type kHeaderSize =
+      (sizeof(Chunk) + alignof(std::max_align_t) - 1) /
+      alignof(std::max_align_t) * alignof(std::max_align_t);
+
+  Chunk *chunks_ = nullptr;
+  std::byte *initial_buffer_ = nullptr;
+  size_type initial_size_ = 0;
+  std::byte *current_ = nullptr;
+  std::byte *end_ = nullptr;
+  size_type next_chunk_size_ = kDefaultChunkSize;
+  size_type upstream_allocations_ = 0;
+
+  static std::byte *AlignUp(std::byte *ptr, size_type alignment) noexcept {
+    auto address = reinterpret_cast<std::uintptr_t>(ptr);
+    auto aligned = (address + alignment - 1) & ~(alignment - 1);
+    return ptr + (aligned - address);
+  }
+  // Takes a new chunk from the heap big enough for bytes with alignment,
+  // chunk sizes grow geometrically so the number of chunks stays logarithmic
+  void NewChunk(size_type bytes, size_type alignment) {
+    size_type size = std::max(next_chunk_size_, bytes + alignment);
+    auto *raw = static_cast<std::byte *>(::operator new(kHeaderSize + size));
+    ++upstream_allocations_;
+    chunks_ = ::new (raw) Chunk{chunks_, size};
+    current_ = raw + kHeaderSize;
+    end_ = current_ + size;
+    next_chunk_size_ = size * 2;
+  }
+
+ public:
+  monotonic_buffer() noexcept {}
+
+  explicit monotonic_buffer(size_type initial_size) noexcept
+      : next_chunk_size_{std::max<size_type>(initial_size, 64)} {}
+  // Serves allocations from a caller owned buffer first
+  monotonic_buffer(void *buffer, size_type size) noexcept
+      : initial_buffer_{static_cast<std::byte *>(buffer)},
+        initial_size_{size},
+        current_{initial_buffer_},
+        end_{initial_buffer_ + size},
+        next_chunk_size_{std::max<size_type>(size, kDefaultChunkSize)} {}
+
+  monotonic_buffer(const monotonic_buffer &) = delete;
+  monotonic_buffer &operator=(const monotonic_buffer &) = delete;
+
+  ~monotonic_buffer() { release(); }
+
+  [[nodiscard]] void *allocate(size_type bytes,
+                               size_type alignment = alignof(
+                                   std::max_align_t)) {
+    std::byte *ptr = current_ ? AlignUp(current_, alignment) : nullptr;
+    if (!ptr || ptr > end_ || static_cast<size_type>(end_ - ptr) < bytes) {
+      NewChunk(bytes, alignment);
+      ptr = AlignUp(current_, alignment);
+    }
+    current_ = ptr + bytes;
+    return ptr;
+  }
+
+  // Only the most recent allocation can be given back, anything else stays
+  // until release()
+  void deallocate(void *ptr, size_type bytes, size_type = 0) noexcept {
+    if (static_cast<std::byte *>(ptr) + bytes == current_)
+      current_ = static_cast<std::byte *>(ptr);
+  }
+  // Resizes a block keeping its first min(old_bytes, new_bytes) bytes. The
+  // most recent allocation grows in place while its chunk has room left.
+  [[nodiscard]] void *reallocate(void *ptr, size_type old_bytes,
+                                 size_type new_bytes,
+                                 size_type alignment = alignof(
+                                     std::max_align_t)) {
+    auto *block = static_cast<std::byte *>(ptr);
+    if (block + old_bytes == current_ &&
+        static_cast<size_type>(end_ - block) >= new_bytes) {
+      current_ = block + new_bytes;
+      return ptr;
+    }
+    void *moved = allocate(new_bytes, alignment);
+    std::memcpy(moved, ptr, std::min(old_bytes, new_bytes));
+    return moved;
+  }
+  // Returns every chunk to the heap, pointers obtained earlier dangle
+  void release() noexcept {
+    while (chunks_) {
+      Chunk *next = chunks_->next;
+      ::operator delete(chunks_);
+      chunks_ = next;
+    }
+    current_ = initial_buffer_;
+    end_ = initial_buffer_ ? initial_buffer_ + initial_size_ : nullptr;
+  }
+
+  size_type upstream_allocations() const noexcept {
+    return upstream_allocations_;
+  }
+};
+
+// Allocator handing out memory of a monotonic_buffer, meant for request
+// scoped containers: growth is a pointer bump and nothing is given back
+// until the buffer itself is released.
+template <class T>
+class arena_allocator {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  template <class U>
+  struct rebind {
+    using other = arena_allocator<U>;
+  };
+
+ private:
+  template <class U>
+  friend class arena_allocator;
+
+  monotonic_buffer *buffer_;
+
+ public:
+  arena_allocator(monotonic_buffer &buffer) noexcept : buffer_{&buffer} {}
+
+  template <class U>
+  arena_allocator(const arena_allocator<U> &other) noexcept
+      : buffer_{other.buffer_} {}
+
+  [[nodiscard]] T *allocate(size_type count) {
+    if (count > static_cast<size_type>(-1) / sizeof(T)) throw std::bad_alloc();
+    return static_cast<T *>(buffer_->allocate(count * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T *ptr, size_type count) noexcept {
+    buffer_->deallocate(ptr, count * sizeof(T), alignof(T));
+  }
+  // Allocator extension used by s21::vector for trivially relocatable T
+  [[nodiscard]] T *reallocate(T *ptr, size_type old_count,
+                              size_type new_count) {
+    if (new_count > static_cast<size_type>(-1) / sizeof(T))
+      throw std::bad_alloc();
+    return static_cast<T *>(buffer_->reallocate(ptr, old_count * sizeof(T),
+                                                new_count * sizeof(T),
+                                                alignof(T)));
+  }
+
+  monotonic_buffer *buffer() const noexcept { return buffer_; }
+
+  template <class U>
+  bool operator==(const arena_allocator<U> &other) const noexcept {
+    return buffer_ == other.buffer_;
+  }
+
+  template <class U>
+  bool operator!=(const arena_allocator<U> &other) const noexcept {
+    return buffer_ != other.buffer_;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_ARENA_ALLOCATOR_H
@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "vector.h"
+
+// Indexed loops over s21::vector<float>. Release builds leave operator[]
+// unchecked, so these loops vectorize like the std::vector ones; at() keeps
+// a bounds check and a throw path in every iteration. The reduction is
+// built with reassociation allowed (see the Makefile), otherwise no
+// compiler may vectorize a float sum.
+
+template <class Vector>
+static void BM_SumIndexed(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  Vector v(count);
+  for (std::size_t i = 0; i < count; ++i) v[i] = static_cast<float>(i % 7);
+  for (auto _ : state) {
+    float sum = 0;
+    for (std::size_t i = 0; i < v.size(); ++i) sum += v[i];
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetBytesProcessed(state.iterations() * count * sizeof(float));
+}
+BENCHMARK_TEMPLATE(BM_SumIndexed, std::vector<float>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_SumIndexed, s21::vector<float>)->Range(1 << 10, 1 << 20);
+
+static void BM_SumAt(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  s21::vector<float> v(count);
+  for (std::size_t i = 0; i < count; ++i) v[i] = static_cast<float>(i % 7);
+  for (auto _ : state) {
+    float sum = 0;
+    for (std::size_t i = 0; i < v.size(); ++i) sum += v.at(i);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetBytesProcessed(state.iterations() * count * sizeof(float));
+}
+BENCHMARK(BM_SumAt)->Range(1 << 10, 1 << 20);
+
+template <class Vector>
+static void BM_AddIndexed(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  Vector a(count);
+  Vector b(count);
+  Vector out(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    a[i] = static_cast<float>(i % 7);
+    b[i] = static_cast<float>(i % 5);
+  }
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < out.size(); ++i) out[i] = a[i] + b[i];
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * count * sizeof(float) * 3);
+}
+BENCHMARK_TEMPLATE(BM_AddIndexed, std::vector<float>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_AddIndexed, s21::vector<float>)->Range(1 << 10, 1 << 20);
+
+BENCHMARK_MAIN();
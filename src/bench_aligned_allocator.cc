@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+
+#include "aligned_allocator.h"
+#include "simd_algorithm.h"
+
+// The triad a = b + s * c with AVX2, on aligned_vector<float, 32> storage
+// with aligned loads and stores, against s21::vector<float> storage shifted
+// by one float, as a subrange of a plain vector often is, with unaligned
+// ones: every other 32 byte access then splits a cache line. Sizes fit L1,
+// L2 and DRAM.
+
+#if S21_SIMD_X86
+
+namespace {
+
+S21_SIMD_AVX2 void TriadAligned(float *a, const float *b, const float *c,
+                                float s, std::size_t n) {
+  const __m256 scale = _mm256_set1_ps(s);
+  for (std::size_t i = 0; i < n; i += 8) {
+    __m256 x = _mm256_load_ps(b + i);
+    __m256 y = _mm256_load_ps(c + i);
+    _mm256_store_ps(a + i, _mm256_add_ps(x, _mm256_mul_ps(scale, y)));
+  }
+}
+
+S21_SIMD_AVX2 void TriadUnaligned(float *a, const float *b, const float *c,
+                                  float s, std::size_t n) {
+  const __m256 scale = _mm256_set1_ps(s);
+  for (std::size_t i = 0; i < n; i += 8) {
+    __m256 x = _mm256_loadu_ps(b + i);
+    __m256 y = _mm256_loadu_ps(c + i);
+    _mm256_storeu_ps(a + i, _mm256_add_ps(x, _mm256_mul_ps(scale, y)));
+  }
+}
+
+bool HasAvx2(benchmark::State &state) {
+  if (s21::simd::detected_isa() < s21::simd::isa::avx2) {
+    state.SkipWithError("AVX2 not supported by this CPU");
+    return false;
+  }
+  return true;
+}
+
+void SetBytes(benchmark::State &state) {
+  state.SetBytesProcessed(state.iterations() * state.range(0) * 3 *
+                          sizeof(float));
+}
+
+}  // namespace
+
+static void BM_TriadAligned(benchmark::State &state) {
+  if (!HasAvx2(state)) return;
+  const std::size_t n = state.range(0);
+  s21::aligned_vector<float, 32> a(n, 0.0f), b(n, 1.0f), c(n, 2.0f);
+  for (auto _ : state) {
+    TriadAligned(a.data(), b.data(), c.data(), 0.5f, n);
+    benchmark::ClobberMemory();
+  }
+  SetBytes(state);
+}
+BENCHMARK(BM_TriadAligned)->RangeMultiplier(8)->Range(1 << 9, 1 << 21);
+
+static void BM_TriadUnaligned(benchmark::State &state) {
+  if (!HasAvx2(state)) return;
+  const std::size_t n = state.range(0);
+  s21::vector<float> a(n + 8, 0.0f), b(n + 8, 1.0f), c(n + 8, 2.0f);
+  for (auto _ : state) {
+    TriadUnaligned(a.data() + 1, b.data() + 1, c.data() + 1, 0.5f, n);
+    benchmark::ClobberMemory();
+  }
+  SetBytes(state);
+}
+BENCHMARK(BM_TriadUnaligned)->RangeMultiplier(8)->Range(1 << 9, 1 << 21);
+
+// Unaligned instructions on aligned data cost about what aligned ones do,
+// the alignment of the storage is what matters
+static void BM_TriadUnalignedOnAligned(benchmark::State &state) {
+  if (!HasAvx2(state)) return;
+  const std::size_t n = state.range(0);
+  s21::aligned_vector<float, 32> a(n, 0.0f), b(n, 1.0f), c(n, 2.0f);
+  for (auto _ : state) {
+    TriadUnaligned(a.data(), b.data(), c.data(), 0.5f, n);
+    benchmark::ClobberMemory();
+  }
+  SetBytes(state);
+}
+BENCHMARK(BM_TriadUnalignedOnAligned)
+    ->RangeMultiplier(8)
+    ->Range(1 << 9, 1 << 21);
+
+#endif  // S21_SIMD_X86
+
+BENCHMARK_MAIN();
@@ -0,0 +1,143 @@
+#ifndef CONTAINERS_CPP_BENCH_ALLOC_COUNTER_H
+#define CONTAINERS_CPP_BENCH_ALLOC_COUNTER_H
+
+#include <malloc.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// Replaces the global operator new and delete with malloc and free that
+// count, per thread, the allocations and the bytes held, so benchmarks show
+// what a workload costs the global allocator without the threads sharing a
+// counter. Defines the replacement functions: include it from the one
+// translation unit of a benchmark binary.
+//
+// A block freed by another thread than the allocating one shifts its bytes
+// from one thread's count to the other's.
+namespace bench {
+
+inline thread_local std::size_t heap_allocations = 0;
+inline thread_local std::size_t heap_bytes = 0;
+inline thread_local std::size_t peak_heap_bytes = 0;
+
+namespace detail {
+
+inline void *Counted(void *ptr) noexcept {
+  if (ptr) {
+    ++heap_allocations;
+    heap_bytes += malloc_usable_size(ptr);
+    peak_heap_bytes = std::max(peak_heap_bytes, heap_bytes);
+  }
+  return ptr;
+}
+
+inline void *Allocate(std::size_t size) noexcept {
+  return Counted(std::malloc(size ? size : 1));
+}
+
+inline void *Allocate(std::size_t size, std::align_val_t alignment) noexcept {
+  auto align = static_cast<std::size_t>(alignment);
+  size = (std::max<std::size_t>(size, 1) + align - 1) & ~(align - 1);
+  return Counted(std::aligned_alloc(align, size));
+}
+
+// Out of line, so the compiler doesn't pair the free with the inlined
+// operator new of the caller and warn about a mismatch
+[[gnu::noinline]] inline void Release(void *ptr) noexcept {
+  if (!ptr) return;
+  heap_bytes -= malloc_usable_size(ptr);
+  std::free(ptr);
+}
+
+template <class... Alignment>
+void *AllocateOrThrow(std::size_t size, Alignment... alignment) {
+  if (void *ptr = Allocate(size, alignment...)) return ptr;
+  throw std::bad_alloc();
+}
+
+}  // namespace detail
+}  // namespace bench
+
+void *operator new(std::size_t size) {
+  return bench::detail::AllocateOrThrow(size);
+}
+
+void *operator new[](std::size_t size) {
+  return bench::detail::AllocateOrThrow(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+  return bench::detail::Allocate(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+  return bench::detail::Allocate(size);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment) {
+  return bench::detail::AllocateOrThrow(size, alignment);
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment) {
+  return bench::detail::AllocateOrThrow(size, alignment);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment,
+                   const std::nothrow_t &) noexcept {
+  return bench::detail::Allocate(size, alignment);
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment,
+                     const std::nothrow_t &) noexcept {
+  return bench::detail::Allocate(size, alignment);
+}
+
+void operator delete(void *ptr) noexcept { bench::detail::Release(ptr); }
+
+void operator delete[](void *ptr) noexcept { bench::detail::Release(ptr); }
+
+void operator delete(void *ptr, std::size_t) noexcept {
+  bench::detail::Release(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept {
+  bench::detail::Release(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept {
+  bench::detail::Release(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept {
+  bench::detail::Release(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t) noexcept {
+  bench::detail::Release(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t) noexcept {
+  bench::detail::Release(ptr);
+}
+
+void operator delete(void *ptr, std::size_t, std::align_val_t) noexcept {
+  bench::detail::Release(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t, std::align_val_t) noexcept {
+  bench::detail::Release(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t,
+                     const std::nothrow_t &) noexcept {
+  bench::detail::Release(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t,
+                       const std::nothrow_t &) noexcept {
+  bench::detail::Release(ptr);
+}
+
+#endif  // CONTAINERS_CPP_BENCH_ALLOC_COUNTER_H
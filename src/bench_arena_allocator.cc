@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "arena_allocator.h"
+#include "bench_alloc_counter.h"
+#include "vector.h"
+
+// Request scoped workload: a handful of vectors are built element by
+// element, read once and thrown away
+template <class MakeVector>
+static void BuildThenDiscard(benchmark::State &state, MakeVector make) {
+  const int count = static_cast<int>(state.range(0));
+  std::size_t before = bench::heap_allocations;
+  for (auto _ : state) {
+    auto request = make();
+    for (int vec = 0; vec < 8; ++vec) {
+      auto v = request.make_vector();
+      for (int i = 0; i < count; ++i) v.push_back(i);
+      benchmark::DoNotOptimize(v.data());
+    }
+  }
+  state.counters["heap_allocs_per_request"] = benchmark::Counter(
+      static_cast<double>(bench::heap_allocations - before),
+      benchmark::Counter::kAvgIterations);
+  state.SetItemsProcessed(state.iterations() * count * 8);
+}
+
+struct HeapRequest {
+  s21::vector<int> make_vector() { return {}; }
+};
+
+struct ArenaRequest {
+  s21::monotonic_buffer buffer{16 * 1024};
+  s21::vector<int, s21::arena_allocator<int>> make_vector() {
+    return s21::vector<int, s21::arena_allocator<int>>{
+        s21::arena_allocator<int>(buffer)};
+  }
+};
+
+static void BM_BuildThenDiscard_Heap(benchmark::State &state) {
+  BuildThenDiscard(state, [] { return HeapRequest{}; });
+}
+BENCHMARK(BM_BuildThenDiscard_Heap)->Arg(16)->Arg(256)->Arg(4096);
+
+static void BM_BuildThenDiscard_Arena(benchmark::State &state) {
+  BuildThenDiscard(state, [] { return ArenaRequest{}; });
+}
+BENCHMARK(BM_BuildThenDiscard_Arena)->Arg(16)->Arg(256)->Arg(4096);
+
+BENCHMARK_MAIN();
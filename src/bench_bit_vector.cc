@@ -0,0 +1,105 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+
+#include "bit_vector.h"
+#include "vector.h"
+
+// Flags as one byte each in s21::vector<bool> and as one bit each in
+// s21::bit_vector: counting, intersecting and scanning them
+
+static constexpr std::size_t kFlags = std::size_t{1} << 22;
+
+static s21::vector<bool> RandomFlags(std::uint32_t seed, int percent) {
+  std::mt19937 gen(seed);
+  s21::vector<bool> flags;
+  flags.reserve(kFlags);
+  for (std::size_t i = 0; i < kFlags; ++i)
+    flags.push_back(static_cast<int>(gen() % 100) < percent);
+  return flags;
+}
+
+static s21::bit_vector Pack(const s21::vector<bool> &flags) {
+  s21::bit_vector bits;
+  bits.reserve(flags.size());
+  for (bool flag : flags) bits.push_back(flag);
+  return bits;
+}
+
+static void BM_CountBytes(benchmark::State &state) {
+  auto flags = RandomFlags(1, 50);
+  for (auto _ : state) {
+    auto ones = std::count(flags.begin(), flags.end(), true);
+    benchmark::DoNotOptimize(ones);
+  }
+  state.counters["bytes"] = static_cast<double>(flags.size());
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() *
+                                                    kFlags));
+}
+BENCHMARK(BM_CountBytes);
+
+static void BM_CountBits(benchmark::State &state) {
+  auto bits = Pack(RandomFlags(1, 50));
+  for (auto _ : state) benchmark::DoNotOptimize(bits.count());
+  state.counters["bytes"] = static_cast<double>(bits.num_words() * 8);
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() *
+                                                    kFlags));
+}
+BENCHMARK(BM_CountBits);
+
+// Flags set in both, e.g. rows matching two filters
+static void BM_AndBytes(benchmark::State &state) {
+  auto a = RandomFlags(2, 50);
+  auto b = RandomFlags(3, 50);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kFlags; ++i) a[i] = a[i] && b[i];
+    benchmark::DoNotOptimize(a.data());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() *
+                                                    kFlags));
+}
+BENCHMARK(BM_AndBytes);
+
+static void BM_AndBits(benchmark::State &state) {
+  auto a = Pack(RandomFlags(2, 50));
+  auto b = Pack(RandomFlags(3, 50));
+  for (auto _ : state) {
+    a &= b;
+    benchmark::DoNotOptimize(a.data());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() *
+                                                    kFlags));
+}
+BENCHMARK(BM_AndBits);
+
+// Visits the set flags when state.range(0) percent of them are set
+static void BM_ScanSetBytes(benchmark::State &state) {
+  auto flags = RandomFlags(4, static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i < kFlags; ++i)
+      if (flags[i]) sum += i;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() *
+                                                    kFlags));
+}
+BENCHMARK(BM_ScanSetBytes)->Arg(1)->Arg(10);
+
+static void BM_ScanSetBits(benchmark::State &state) {
+  auto bits = Pack(RandomFlags(4, static_cast<int>(state.range(0))));
+  for (auto _ : state) {
+    std::size_t sum = 0;
+    for (auto i = bits.find_first(); i != s21::bit_vector::npos;
+         i = bits.find_next(i + 1))
+      sum += i;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() *
+                                                    kFlags));
+}
+BENCHMARK(BM_ScanSetBits)->Arg(1)->Arg(10);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+
+#include <list>
+#include <string>
+#include <vector>
+
+#include "vector.h"
+
+// Loading state.range(0) elements from another container: one range call
+// against the element by element pattern it replaces
+
+static std::vector<int> Source(int count) {
+  std::vector<int> source(count);
+  for (int i = 0; i < count; ++i) source[i] = i;
+  return source;
+}
+
+static void BM_AppendLoop(benchmark::State &state) {
+  auto source = Source(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    s21::vector<int> v{1, 2, 3};
+    for (int x : source) v.push_back(x);
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AppendLoop)->Range(1 << 8, 1 << 16);
+
+static void BM_AppendRange(benchmark::State &state) {
+  auto source = Source(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    s21::vector<int> v{1, 2, 3};
+    v.append_range(source);
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AppendRange)->Range(1 << 8, 1 << 16);
+
+static void BM_MiddleInsertLoop(benchmark::State &state) {
+  auto source = Source(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    s21::vector<int> v(1024, 0);
+    std::size_t pos = v.size() / 2;
+    for (int x : source) v.insert(v.begin() + pos++, x);
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MiddleInsertLoop)->Range(1 << 8, 1 << 14);
+
+static void BM_MiddleInsertRange(benchmark::State &state) {
+  auto source = Source(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    s21::vector<int> v(1024, 0);
+    v.insert(v.begin() + v.size() / 2, source.begin(), source.end());
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MiddleInsertRange)->Range(1 << 8, 1 << 14);
+
+static void BM_MiddleInsertRangeStd(benchmark::State &state) {
+  auto source = Source(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    std::vector<int> v(1024, 0);
+    v.insert(v.begin() + v.size() / 2, source.begin(), source.end());
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MiddleInsertRangeStd)->Range(1 << 8, 1 << 14);
+
+static void BM_RangeConstructFromList(benchmark::State &state) {
+  std::list<std::string> source;
+  for (int i = 0; i < state.range(0); ++i)
+    source.push_back("element number " + std::to_string(i));
+  for (auto _ : state) {
+    s21::vector<std::string> v(source.begin(), source.end());
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RangeConstructFromList)->Range(1 << 8, 1 << 14);
+
+BENCHMARK_MAIN();
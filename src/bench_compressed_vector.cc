@@ -0,0 +1,154 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+
+#include "compressed_vector.h"
+#include "vector.h"
+
+// Columns of 64-bit integers the way they look in practice, compressed and
+// decoded again. "ratio" is the uncompressed size over memory_bytes(), the
+// bytes per second count the decoded uncompressed bytes
+
+static constexpr std::size_t kValues = std::size_t{1} << 22;
+
+enum Distribution { kSortedIds, kTimestamps, kSmallValues, kRandom };
+
+static const char *Name(Distribution distribution) {
+  switch (distribution) {
+    case kSortedIds:
+      return "sorted ids, gaps 1-100";
+    case kTimestamps:
+      return "ns timestamps, ~10us apart";
+    case kSmallValues:
+      return "unsorted, 16 bit spread";
+    default:
+      return "random 64 bit";
+  }
+}
+
+static s21::vector<std::uint64_t> Generate(Distribution distribution) {
+  std::mt19937_64 gen(distribution);
+  s21::vector<std::uint64_t> values;
+  values.reserve(kValues);
+  std::uint64_t value = 1'700'000'000'000'000'000;
+  for (std::size_t i = 0; i < kValues; ++i) {
+    switch (distribution) {
+      case kSortedIds:
+        value += 1 + gen() % 100;
+        break;
+      case kTimestamps:
+        value += 9'000 + gen() % 2'000;
+        break;
+      case kSmallValues:
+        value = (std::uint64_t{1} << 40) + gen() % 65'536;
+        break;
+      default:
+        value = gen();
+    }
+    values.push_back(value);
+  }
+  return values;
+}
+
+static void SetRatio(benchmark::State &state,
+                     const s21::compressed_vector<> &compressed) {
+  state.counters["ratio"] =
+      static_cast<double>(compressed.size() * sizeof(std::uint64_t)) /
+      static_cast<double>(compressed.memory_bytes());
+}
+
+static void BM_Decode(benchmark::State &state) {
+  auto distribution = static_cast<Distribution>(state.range(0));
+  auto values = Generate(distribution);
+  s21::compressed_vector<> compressed(values.begin(), values.end());
+  s21::vector<std::uint64_t> out;
+  out.reserve(kValues);
+  for (auto _ : state) {
+    out.clear();
+    compressed.decode(out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  SetRatio(state, compressed);
+  state.SetLabel(Name(distribution));
+  state.SetBytesProcessed(static_cast<std::int64_t>(
+      state.iterations() * kValues * sizeof(std::uint64_t)));
+}
+BENCHMARK(BM_Decode)->DenseRange(kSortedIds, kRandom);
+
+// Copying the uncompressed column, what decoding competes with
+static void BM_CopyUncompressed(benchmark::State &state) {
+  auto values = Generate(kSortedIds);
+  s21::vector<std::uint64_t> out;
+  out.reserve(kValues);
+  for (auto _ : state) {
+    out.clear();
+    out.insert(out.end(), values.begin(), values.end());
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(
+      state.iterations() * kValues * sizeof(std::uint64_t)));
+}
+BENCHMARK(BM_CopyUncompressed);
+
+static void BM_Encode(benchmark::State &state) {
+  auto distribution = static_cast<Distribution>(state.range(0));
+  auto values = Generate(distribution);
+  for (auto _ : state) {
+    s21::compressed_vector<> compressed(values.begin(), values.end());
+    benchmark::DoNotOptimize(&compressed);
+  }
+  state.SetLabel(Name(distribution));
+  state.SetBytesProcessed(static_cast<std::int64_t>(
+      state.iterations() * kValues * sizeof(std::uint64_t)));
+}
+BENCHMARK(BM_Encode)->Arg(kSortedIds)->Arg(kSmallValues);
+
+static void BM_RandomAccess(benchmark::State &state) {
+  auto distribution = static_cast<Distribution>(state.range(0));
+  auto values = Generate(distribution);
+  s21::compressed_vector<> compressed(values.begin(), values.end());
+  std::mt19937_64 gen(9);
+  s21::vector<std::size_t> positions;
+  for (int i = 0; i < 4096; ++i) positions.push_back(gen() % kValues);
+  for (auto _ : state) {
+    std::uint64_t sum = 0;
+    for (auto pos : positions) sum += compressed[pos];
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetLabel(Name(distribution));
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() *
+                                                    positions.size()));
+}
+BENCHMARK(BM_RandomAccess)->Arg(kSortedIds)->Arg(kSmallValues);
+
+template <bool Compressed>
+static void BM_LowerBound(benchmark::State &state) {
+  auto values = Generate(kSortedIds);
+  s21::compressed_vector<> compressed(values.begin(), values.end());
+  std::mt19937_64 gen(10);
+  s21::vector<std::uint64_t> probes;
+  for (int i = 0; i < 4096; ++i)
+    probes.push_back(values.front() +
+                     gen() % (values.back() - values.front()));
+  for (auto _ : state) {
+    std::size_t sum = 0;
+    for (auto probe : probes) {
+      if constexpr (Compressed) {
+        sum += compressed.lower_bound(probe);
+      } else {
+        sum += static_cast<std::size_t>(
+            std::lower_bound(values.begin(), values.end(), probe) -
+            values.begin());
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() *
+                                                    probes.size()));
+}
+BENCHMARK_TEMPLATE(BM_LowerBound, false);
+BENCHMARK_TEMPLATE(BM_LowerBound, true);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include "concurrent_vector.h"
+#include "vector.h"
+
+// Appends from 1 to 64 threads into one shared vector: concurrent_vector
+// against an s21::vector behind a mutex. Every iteration appends kBatch
+// elements per thread; the vector starts empty for each run.
+
+namespace {
+
+constexpr int kBatch = 1000;
+
+struct Locked {
+  std::mutex mutex;
+  s21::vector<std::uint64_t> vec;
+
+  void push_back(std::uint64_t value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    vec.push_back(value);
+  }
+};
+
+std::unique_ptr<s21::concurrent_vector<std::uint64_t>> concurrent;
+std::unique_ptr<Locked> locked;
+
+}  // namespace
+
+static void BM_ConcurrentPushBack(benchmark::State &state) {
+  if (state.thread_index() == 0)
+    concurrent = std::make_unique<s21::concurrent_vector<std::uint64_t>>();
+  for (auto _ : state)
+    for (int i = 0; i < kBatch; ++i) concurrent->push_back(i);
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+BENCHMARK(BM_ConcurrentPushBack)->ThreadRange(1, 64)->UseRealTime();
+
+static void BM_ConcurrentGrowBy(benchmark::State &state) {
+  if (state.thread_index() == 0)
+    concurrent = std::make_unique<s21::concurrent_vector<std::uint64_t>>();
+  for (auto _ : state)
+    benchmark::DoNotOptimize(concurrent->grow_by(kBatch, 1));
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+BENCHMARK(BM_ConcurrentGrowBy)->ThreadRange(1, 64)->UseRealTime();
+
+static void BM_MutexPushBack(benchmark::State &state) {
+  if (state.thread_index() == 0) locked = std::make_unique<Locked>();
+  for (auto _ : state)
+    for (int i = 0; i < kBatch; ++i) locked->push_back(i);
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+BENCHMARK(BM_MutexPushBack)->ThreadRange(1, 64)->UseRealTime();
+
+// Readers of the published prefix next to one appending thread
+static void BM_ConcurrentReadWhileAppending(benchmark::State &state) {
+  if (state.thread_index() == 0) {
+    concurrent = std::make_unique<s21::concurrent_vector<std::uint64_t>>();
+    concurrent->grow_by(1 << 16, 1);
+  }
+  std::uint64_t sum = 0;
+  for (auto _ : state) {
+    if (state.thread_index() == 0) {
+      for (int i = 0; i < kBatch; ++i) concurrent->push_back(i);
+    } else {
+      for (int i = 0; i < kBatch; ++i) sum += (*concurrent)[i * 64];
+    }
+  }
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+BENCHMARK(BM_ConcurrentReadWhileAppending)->ThreadRange(2, 64)->UseRealTime();
+
+BENCHMARK_MAIN();
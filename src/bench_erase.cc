@@ -0,0 +1,131 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "vector.h"
+
+// A filter dropping every third element of state.range(0): erase() per
+// match, the quadratic loop it used to take, against one erase_if() pass
+// and, when the order doesn't matter, unordered_erase(). Then dropping a
+// block from the middle element by element against one range erase().
+// The quadratic loops stop at smaller sizes.
+
+namespace {
+
+template <class T>
+s21::vector<T> Make(std::size_t count);
+
+template <>
+s21::vector<int> Make(std::size_t count) {
+  s21::vector<int> v;
+  v.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) v.push_back(static_cast<int>(i));
+  return v;
+}
+
+template <>
+s21::vector<std::string> Make(std::size_t count) {
+  s21::vector<std::string> v;
+  v.reserve(count);
+  for (std::size_t i = 0; i < count; ++i)
+    v.push_back(std::string(24, 'a') + std::to_string(i));
+  return v;
+}
+
+bool Dropped(int value) { return value % 3 == 0; }
+bool Dropped(const std::string &value) { return value.back() % 3 == 0; }
+
+}  // namespace
+
+template <class T>
+static void BM_FilterEraseLoop(benchmark::State &state) {
+  const auto source = Make<T>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto v = source;
+    state.ResumeTiming();
+    for (auto it = v.begin(); it != v.end();) {
+      if (Dropped(*it)) {
+        it = v.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_FilterEraseLoop, int)->Range(1 << 8, 1 << 14);
+BENCHMARK_TEMPLATE(BM_FilterEraseLoop, std::string)->Range(1 << 8, 1 << 14);
+
+template <class T>
+static void BM_FilterEraseIf(benchmark::State &state) {
+  const auto source = Make<T>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto v = source;
+    state.ResumeTiming();
+    s21::erase_if(v, [](const T &value) { return Dropped(value); });
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_FilterEraseIf, int)->Range(1 << 8, 1 << 16);
+BENCHMARK_TEMPLATE(BM_FilterEraseIf, std::string)->Range(1 << 8, 1 << 16);
+
+template <class T>
+static void BM_FilterUnorderedErase(benchmark::State &state) {
+  const auto source = Make<T>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto v = source;
+    state.ResumeTiming();
+    for (auto it = v.begin(); it != v.end();) {
+      if (Dropped(*it)) {
+        it = v.unordered_erase(it);
+      } else {
+        ++it;
+      }
+    }
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_FilterUnorderedErase, int)->Range(1 << 8, 1 << 16);
+BENCHMARK_TEMPLATE(BM_FilterUnorderedErase, std::string)
+    ->Range(1 << 8, 1 << 16);
+
+// The middle half of the vector
+template <class T>
+static void BM_BlockEraseLoop(benchmark::State &state) {
+  const auto source = Make<T>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto v = source;
+    state.ResumeTiming();
+    auto first = v.begin() + v.size() / 4;
+    for (std::size_t i = 0, n = v.size() / 2; i < n; ++i) v.erase(first);
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_BlockEraseLoop, int)->Range(1 << 8, 1 << 14);
+BENCHMARK_TEMPLATE(BM_BlockEraseLoop, std::string)->Range(1 << 8, 1 << 14);
+
+template <class T>
+static void BM_BlockEraseRange(benchmark::State &state) {
+  const auto source = Make<T>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto v = source;
+    state.ResumeTiming();
+    auto first = v.begin() + v.size() / 4;
+    v.erase(first, first + v.size() / 2);
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_BlockEraseRange, int)->Range(1 << 8, 1 << 16);
+BENCHMARK_TEMPLATE(BM_BlockEraseRange, std::string)->Range(1 << 8, 1 << 16);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,158 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "flat_map.h"
+#include "flat_set.h"
+
+// Lookup tables of a few thousand entries, built once and read many times
+
+static std::vector<std::uint64_t> RandomKeys(std::size_t count,
+                                             std::uint32_t seed) {
+  std::mt19937_64 gen(seed);
+  std::vector<std::uint64_t> keys(count);
+  for (auto &key : keys) key = gen();
+  return keys;
+}
+
+// Looks up keys in random order, half of them missing
+template <class Set>
+static void BM_SetLookup(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  auto keys = RandomKeys(size, 1);
+  Set set(keys.begin(), keys.end());
+  auto probes = RandomKeys(1024, 2);
+  for (std::size_t i = 0; i < probes.size(); i += 2)
+    probes[i] = keys[probes[i] % size];
+  for (auto _ : state) {
+    std::size_t found = 0;
+    for (auto key : probes) found += set.count(key);
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(probes.size()));
+}
+BENCHMARK_TEMPLATE(BM_SetLookup, std::set<std::uint64_t>)
+    ->Arg(256)
+    ->Arg(4096)
+    ->Arg(65536);
+BENCHMARK_TEMPLATE(BM_SetLookup, s21::flat_set<std::uint64_t>)
+    ->Arg(256)
+    ->Arg(4096)
+    ->Arg(65536);
+
+// The same search through std::lower_bound, which branches on every level
+static void BM_SetLookupStdLowerBound(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  auto keys = RandomKeys(size, 1);
+  std::sort(keys.begin(), keys.end());
+  auto probes = RandomKeys(1024, 2);
+  for (std::size_t i = 0; i < probes.size(); i += 2)
+    probes[i] = keys[probes[i] % size];
+  for (auto _ : state) {
+    std::size_t found = 0;
+    for (auto key : probes) {
+      auto it = std::lower_bound(keys.begin(), keys.end(), key);
+      found += it != keys.end() && *it == key;
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(probes.size()));
+}
+BENCHMARK(BM_SetLookupStdLowerBound)->Arg(256)->Arg(4096)->Arg(65536);
+
+template <class Map>
+static void BM_MapLookup(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  auto keys = RandomKeys(size, 3);
+  Map map;
+  for (auto key : keys) map.insert({key, key * 3});
+  auto probes = RandomKeys(1024, 4);
+  for (auto &probe : probes) probe = keys[probe % size];
+  for (auto _ : state) {
+    std::uint64_t sum = 0;
+    for (auto key : probes) sum += map.find(key)->second;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(probes.size()));
+}
+BENCHMARK_TEMPLATE(BM_MapLookup, std::map<std::uint64_t, std::uint64_t>)
+    ->Arg(256)
+    ->Arg(4096)
+    ->Arg(65536);
+BENCHMARK_TEMPLATE(BM_MapLookup, s21::flat_map<std::uint64_t, std::uint64_t>)
+    ->Arg(256)
+    ->Arg(4096)
+    ->Arg(65536);
+
+// Builds the table from unsorted pairs with one range insert
+template <class Map>
+static void BM_MapBuild(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  auto keys = RandomKeys(size, 5);
+  std::vector<std::pair<std::uint64_t, std::uint64_t>> pairs;
+  for (auto key : keys) pairs.emplace_back(key, key);
+  for (auto _ : state) {
+    Map map(pairs.begin(), pairs.end());
+    benchmark::DoNotOptimize(&map);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(size));
+}
+BENCHMARK_TEMPLATE(BM_MapBuild, std::map<std::uint64_t, std::uint64_t>)
+    ->Arg(4096)
+    ->Arg(65536);
+BENCHMARK_TEMPLATE(BM_MapBuild, s21::flat_map<std::uint64_t, std::uint64_t>)
+    ->Arg(4096)
+    ->Arg(65536);
+
+// Adds a batch of state.range(1) keys to a set of state.range(0): the bulk
+// merge against one shifting insert per key
+template <bool Bulk>
+static void BM_SetAddBatch(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto batch = static_cast<std::size_t>(state.range(1));
+  auto keys = RandomKeys(size, 6);
+  auto extra = RandomKeys(batch, 7);
+  const s21::flat_set<std::uint64_t> base(keys.begin(), keys.end());
+  for (auto _ : state) {
+    state.PauseTiming();
+    s21::flat_set<std::uint64_t> set(base);
+    state.ResumeTiming();
+    if constexpr (Bulk) {
+      set.insert(extra.begin(), extra.end());
+    } else {
+      for (auto key : extra) set.insert(key);
+    }
+    benchmark::DoNotOptimize(set.size());
+  }
+}
+BENCHMARK_TEMPLATE(BM_SetAddBatch, true)
+    ->Args({65536, 64})
+    ->Args({65536, 4096});
+BENCHMARK_TEMPLATE(BM_SetAddBatch, false)
+    ->Args({65536, 64})
+    ->Args({65536, 4096});
+
+template <class Set>
+static void BM_SetBuild(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  auto keys = RandomKeys(size, 8);
+  for (auto _ : state) {
+    Set set(keys.begin(), keys.end());
+    benchmark::DoNotOptimize(&set);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(size));
+}
+BENCHMARK_TEMPLATE(BM_SetBuild, std::set<std::uint64_t>)->Arg(65536);
+BENCHMARK_TEMPLATE(BM_SetBuild, s21::flat_set<std::uint64_t>)->Arg(65536);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,40 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+
+#include "bench_alloc_counter.h"
+#include "growth_policy.h"
+#include "vector.h"
+
+// Grows a vector of state.range(0) doubles by push_back. Reports the peak
+// heap use and the unused capacity left at the end
+template <class Policy>
+static void BM_Grow(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  std::size_t peak = 0;
+  std::size_t wasted = 0;
+  for (auto _ : state) {
+    std::size_t baseline = bench::heap_bytes;
+    bench::peak_heap_bytes = bench::heap_bytes;
+    {
+      s21::vector<double, std::allocator<double>, Policy> v;
+      for (std::size_t i = 0; i < count; ++i) v.push_back(1.0 * i);
+      benchmark::DoNotOptimize(v.data());
+      wasted = (v.capacity() - v.size()) * sizeof(double);
+    }
+    peak = std::max(peak, bench::peak_heap_bytes - baseline);
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+  state.counters["peak_MiB"] = static_cast<double>(peak) / (1 << 20);
+  state.counters["wasted_MiB"] = static_cast<double>(wasted) / (1 << 20);
+}
+
+#define GROWTH_BENCHMARK(Policy) \
+  BENCHMARK_TEMPLATE(BM_Grow, Policy)->Range(1 << 10, 1 << 24)
+
+GROWTH_BENCHMARK(s21::growth::doubling);
+GROWTH_BENCHMARK(s21::growth::one_and_a_half);
+GROWTH_BENCHMARK(s21::growth::size_class);
+GROWTH_BENCHMARK(s21::growth::page_granular<>);
+
+BENCHMARK_MAIN();
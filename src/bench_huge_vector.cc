@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+#include "huge_vector.h"
+#include "vector.h"
+
+// Growth of a multi-gigabyte vector of 64 bit records by push_back: the
+// default s21::vector copies the block on every doubling and briefly holds
+// the old and the new one, huge_vector remaps it. peak_rss is the high water
+// mark of the resident set over one iteration, in bytes.
+
+namespace {
+
+void ResetPeakRss() {
+  std::ofstream("/proc/self/clear_refs") << "5";
+}
+
+double PeakRss() {
+  std::ifstream status("/proc/self/status");
+  for (std::string line; std::getline(status, line);)
+    if (line.rfind("VmHWM:", 0) == 0) return std::stod(line.substr(6)) * 1024;
+  return 0;
+}
+
+template <class Vector>
+void ReleasePages(Vector &) {}
+
+template <class T, bool HugePages>
+void ReleasePages(s21::huge_vector<T, HugePages> &v) {
+  v.release_pages();
+}
+
+}  // namespace
+
+template <class Vector>
+static void BM_Grow(benchmark::State &state) {
+  const std::size_t count = state.range(0) / sizeof(std::uint64_t);
+  double peak = 0;
+  for (auto _ : state) {
+    ResetPeakRss();
+    Vector v;
+    for (std::size_t i = 0; i < count; ++i) v.push_back(i);
+    benchmark::DoNotOptimize(v.data());
+    double rss = PeakRss();
+    if (rss > peak) peak = rss;
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+  state.counters["peak_rss"] = peak;
+}
+
+// huge_vector gives the pages back on every round and faults them in again
+template <class Vector>
+static void BM_ClearRefill(benchmark::State &state) {
+  const std::size_t count = state.range(0) / sizeof(std::uint64_t);
+  Vector v;
+  v.reserve(count);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < count; ++i) v.push_back(i);
+    benchmark::DoNotOptimize(v.data());
+    v.clear();
+    ReleasePages(v);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_Grow, s21::vector<std::uint64_t>)
+    ->RangeMultiplier(4)
+    ->Range(std::int64_t{1} << 24, std::int64_t{1} << 30)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Grow, s21::huge_vector<std::uint64_t>)
+    ->RangeMultiplier(4)
+    ->Range(std::int64_t{1} << 24, std::int64_t{1} << 30)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Grow, s21::huge_vector<std::uint64_t, false>)
+    ->RangeMultiplier(4)
+    ->Range(std::int64_t{1} << 24, std::int64_t{1} << 30)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ClearRefill, s21::vector<std::uint64_t>)
+    ->Arg(std::int64_t{1} << 28)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ClearRefill, s21::huge_vector<std::uint64_t>)
+    ->Arg(std::int64_t{1} << 28)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,129 @@
+#include <benchmark/benchmark.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "mapped_vector.h"
+#include "vector.h"
+
+// Start-up cost of a table of records: opening a mapped_vector file against
+// rebuilding an s21::vector by reading a plain dump of the same records
+// and push_back-ing them. Cold runs drop the file from the page cache
+// first, warm runs find it cached. The Scan variants also touch every
+// record, which is when a mapped file actually gets paged in.
+
+namespace {
+
+struct Record {
+  std::uint64_t id;
+  double value;
+  std::uint32_t flags;
+  std::uint32_t group;
+};
+
+std::string Path(const char *name, std::int64_t count) {
+  return "/tmp/s21_bench_" + std::string(name) + "_" +
+         std::to_string(count) + "_" + std::to_string(getpid());
+}
+
+Record Make(std::uint64_t i) {
+  return Record{i, i * 0.25, static_cast<std::uint32_t>(i),
+                static_cast<std::uint32_t>(i % 16)};
+}
+
+// The file as a mapped_vector and as a raw dump
+std::string WriteMapped(std::int64_t count) {
+  std::string path = Path("mapped", count);
+  s21::mapped_vector<Record> v(path, s21::map_mode::truncate);
+  v.reserve(count);
+  for (std::int64_t i = 0; i < count; ++i) v.push_back(Make(i));
+  v.flush();
+  return path;
+}
+
+std::string WriteDump(std::int64_t count) {
+  std::string path = Path("dump", count);
+  std::FILE *file = std::fopen(path.c_str(), "wb");
+  for (std::int64_t i = 0; i < count; ++i) {
+    Record r = Make(i);
+    std::fwrite(&r, sizeof(r), 1, file);
+  }
+  std::fclose(file);
+  return path;
+}
+
+// Evicts the clean pages of the file from the page cache
+void DropCache(const std::string &path) {
+  int fd = open(path.c_str(), O_RDONLY);
+  fdatasync(fd);
+  posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+  close(fd);
+}
+
+std::uint64_t Sum(const Record *first, const Record *last) {
+  std::uint64_t sum = 0;
+  for (; first != last; ++first) sum += first->id + first->group;
+  return sum;
+}
+
+}  // namespace
+
+template <bool Cold, bool Scan>
+static void BM_MappedOpen(benchmark::State &state) {
+  const std::string path = WriteMapped(state.range(0));
+  for (auto _ : state) {
+    if (Cold) {
+      state.PauseTiming();
+      DropCache(path);
+      state.ResumeTiming();
+    }
+    s21::mapped_vector<Record> v(path, s21::map_mode::read_only);
+    benchmark::DoNotOptimize(Scan ? Sum(v.begin(), v.end()) : v.size());
+  }
+  std::remove(path.c_str());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_MappedOpen, true, false)
+    ->Range(1 << 16, 1 << 21)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_MappedOpen, false, false)
+    ->Range(1 << 16, 1 << 21)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_MappedOpen, true, true)
+    ->Range(1 << 16, 1 << 21)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_MappedOpen, false, true)
+    ->Range(1 << 16, 1 << 21)
+    ->UseRealTime();
+
+// What the services do today: read record by record, push_back each
+template <bool Cold>
+static void BM_VectorRebuild(benchmark::State &state) {
+  const std::string path = WriteDump(state.range(0));
+  for (auto _ : state) {
+    if (Cold) {
+      state.PauseTiming();
+      DropCache(path);
+      state.ResumeTiming();
+    }
+    s21::vector<Record> v;
+    std::FILE *file = std::fopen(path.c_str(), "rb");
+    Record r;
+    while (std::fread(&r, sizeof(r), 1, file) == 1) v.push_back(r);
+    std::fclose(file);
+    benchmark::DoNotOptimize(Sum(v.data(), v.data() + v.size()));
+  }
+  std::remove(path.c_str());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_VectorRebuild, true)
+    ->Range(1 << 16, 1 << 21)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_VectorRebuild, false)
+    ->Range(1 << 16, 1 << 21)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
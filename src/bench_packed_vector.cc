@@ -0,0 +1,130 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+
+#include "packed_vector.h"
+#include "vector.h"
+
+// Small integers stored as std::uint32_t and packed to Bits bits: summing
+// all of them, which streams Bits / 32 of the bytes, and random reads
+
+static constexpr std::size_t kValues = std::size_t{1} << 24;
+
+template <unsigned Bits>
+static s21::packed_vector<Bits> RandomPacked() {
+  std::mt19937_64 gen(Bits);
+  s21::packed_vector<Bits> packed;
+  packed.reserve(kValues);
+  for (std::size_t i = 0; i < kValues; ++i)
+    packed.push_back(
+        static_cast<typename s21::packed_vector<Bits>::value_type>(
+            gen() & s21::packed_vector<Bits>::max_value));
+  return packed;
+}
+
+template <unsigned Bits>
+static s21::vector<std::uint32_t> RandomWords() {
+  std::mt19937_64 gen(Bits);
+  s21::vector<std::uint32_t> values;
+  values.reserve(kValues);
+  for (std::size_t i = 0; i < kValues; ++i)
+    values.push_back(static_cast<std::uint32_t>(
+        gen() & s21::packed_vector<Bits>::max_value));
+  return values;
+}
+
+template <unsigned Bits>
+static void BM_SumWords(benchmark::State &state) {
+  auto values = RandomWords<Bits>();
+  for (auto _ : state) {
+    std::uint64_t sum = 0;
+    for (auto value : values) sum += value;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.counters["bytes"] = static_cast<double>(kValues * 4);
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() *
+                                                    kValues));
+}
+BENCHMARK_TEMPLATE(BM_SumWords, 4);
+BENCHMARK_TEMPLATE(BM_SumWords, 12);
+BENCHMARK_TEMPLATE(BM_SumWords, 20);
+
+// Through the batch unpacking iterator
+template <unsigned Bits>
+static void BM_SumPacked(benchmark::State &state) {
+  auto packed = RandomPacked<Bits>();
+  for (auto _ : state) {
+    std::uint64_t sum = 0;
+    for (auto value : packed) sum += value;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.counters["bytes"] = static_cast<double>(kValues * Bits / 8);
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() *
+                                                    kValues));
+}
+BENCHMARK_TEMPLATE(BM_SumPacked, 4);
+BENCHMARK_TEMPLATE(BM_SumPacked, 12);
+BENCHMARK_TEMPLATE(BM_SumPacked, 20);
+
+// unpack() into a buffer of the caller, whose loop then vectorizes
+template <unsigned Bits>
+static void BM_SumPackedUnpack(benchmark::State &state) {
+  using Packed = s21::packed_vector<Bits>;
+  auto packed = RandomPacked<Bits>();
+  for (auto _ : state) {
+    std::uint64_t sum = 0;
+    typename Packed::value_type buffer[Packed::batch];
+    for (std::size_t first = 0; first < packed.size();
+         first += Packed::batch) {
+      packed.unpack(first, Packed::batch, buffer);
+      for (auto value : buffer) sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() *
+                                                    kValues));
+}
+BENCHMARK_TEMPLATE(BM_SumPackedUnpack, 4);
+BENCHMARK_TEMPLATE(BM_SumPackedUnpack, 12);
+BENCHMARK_TEMPLATE(BM_SumPackedUnpack, 20);
+
+// One get() per value, without the batches
+template <unsigned Bits>
+static void BM_SumPackedGet(benchmark::State &state) {
+  auto packed = RandomPacked<Bits>();
+  for (auto _ : state) {
+    std::uint64_t sum = 0;
+    for (std::size_t i = 0; i < packed.size(); ++i) sum += packed.get(i);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() *
+                                                    kValues));
+}
+BENCHMARK_TEMPLATE(BM_SumPackedGet, 12);
+
+template <class Values>
+static void RandomReads(benchmark::State &state, const Values &values) {
+  std::mt19937_64 gen(7);
+  s21::vector<std::size_t> positions;
+  for (int i = 0; i < 4096; ++i) positions.push_back(gen() % kValues);
+  for (auto _ : state) {
+    std::uint64_t sum = 0;
+    for (auto pos : positions) sum += values[pos];
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() *
+                                                    positions.size()));
+}
+
+static void BM_RandomReadWords(benchmark::State &state) {
+  RandomReads(state, RandomWords<12>());
+}
+BENCHMARK(BM_RandomReadWords);
+
+static void BM_RandomReadPacked(benchmark::State &state) {
+  RandomReads(state, RandomPacked<12>());
+}
+BENCHMARK(BM_RandomReadPacked);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,152 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <thread>
+
+#include "parallel_algorithm.h"
+
+// s21::parallel algorithms over 16M elements with 1, 2, 4, ... up to the
+// hardware threads (the first argument), next to the sequential std
+// algorithm. A pool of n - 1 workers plus the calling thread runs n.
+
+namespace {
+
+constexpr std::size_t kSize = std::size_t{1} << 24;
+
+const s21::vector<std::int32_t> &Input() {
+  static const s21::vector<std::int32_t> input = [] {
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<std::int32_t> value(-1000000, 1000000);
+    s21::vector<std::int32_t> vec;
+    vec.reserve(kSize);
+    for (std::size_t i = 0; i < kSize; ++i) vec.push_back(value(engine));
+    return vec;
+  }();
+  return input;
+}
+
+void Threads(benchmark::internal::Benchmark *bench) {
+  unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+  for (unsigned threads = 1; threads < hardware; threads *= 2)
+    bench->Arg(threads);
+  bench->Arg(hardware);
+}
+
+struct Parallel {
+  explicit Parallel(benchmark::State &state)
+      : pool(state.range(0) - 1), policy{&pool} {
+    state.counters["threads"] = state.range(0);
+  }
+
+  s21::thread_pool pool;
+  s21::parallel::policy policy;
+};
+
+// Enough work per element that the memory bus isn't the limit
+double Work(std::int32_t x) { return std::sqrt(std::abs(x) + 1.0); }
+
+}  // namespace
+
+static void BM_ForEach(benchmark::State &state) {
+  Parallel parallel(state);
+  s21::vector<double> vec(Input().begin(), Input().end());
+  for (auto _ : state) {
+    s21::parallel::for_each(parallel.policy, vec.begin(), vec.end(),
+                            [](double &x) { x = std::sqrt(x * x + 1.0); });
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_ForEach)->Apply(Threads)->UseRealTime();
+
+static void BM_Transform(benchmark::State &state) {
+  Parallel parallel(state);
+  s21::vector<double> out(kSize);
+  for (auto _ : state) {
+    s21::parallel::transform(parallel.policy, Input().begin(), Input().end(),
+                             out.begin(), Work);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_Transform)->Apply(Threads)->UseRealTime();
+
+static void BM_Reduce(benchmark::State &state) {
+  Parallel parallel(state);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(s21::parallel::reduce(
+        parallel.policy, Input().begin(), Input().end(), std::int64_t{0}));
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_Reduce)->Apply(Threads)->UseRealTime();
+
+static void BM_ReduceDeterministic(benchmark::State &state) {
+  Parallel parallel(state);
+  parallel.policy.deterministic = true;
+  s21::vector<double> vec(Input().begin(), Input().end());
+  for (auto _ : state)
+    benchmark::DoNotOptimize(
+        s21::parallel::reduce(parallel.policy, vec.begin(), vec.end(), 0.0));
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_ReduceDeterministic)->Apply(Threads)->UseRealTime();
+
+static void BM_Sort(benchmark::State &state) {
+  Parallel parallel(state);
+  for (auto _ : state) {
+    state.PauseTiming();
+    s21::vector<std::int32_t> vec = Input();
+    state.ResumeTiming();
+    s21::parallel::sort(parallel.policy, vec.begin(), vec.end());
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_Sort)->Apply(Threads)->UseRealTime()->Unit(
+    benchmark::kMillisecond);
+
+static void BM_StdSort(benchmark::State &state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    s21::vector<std::int32_t> vec = Input();
+    state.ResumeTiming();
+    std::sort(vec.begin(), vec.end());
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_StdSort)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+static void BM_StablePartition(benchmark::State &state) {
+  Parallel parallel(state);
+  for (auto _ : state) {
+    state.PauseTiming();
+    s21::vector<std::int32_t> vec = Input();
+    state.ResumeTiming();
+    benchmark::DoNotOptimize(s21::parallel::stable_partition(
+        parallel.policy, vec.begin(), vec.end(),
+        [](std::int32_t x) { return x < 0; }));
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_StablePartition)->Apply(Threads)->UseRealTime()->Unit(
+    benchmark::kMillisecond);
+
+static void BM_StdStablePartition(benchmark::State &state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    s21::vector<std::int32_t> vec = Input();
+    state.ResumeTiming();
+    benchmark::DoNotOptimize(std::stable_partition(
+        vec.begin(), vec.end(), [](std::int32_t x) { return x < 0; }));
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_StdStablePartition)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
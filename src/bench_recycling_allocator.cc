@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <type_traits>
+
+#include "bench_alloc_counter.h"
+#include "recycling_allocator.h"
+#include "vector.h"
+
+// A request handler: 32 vectors of 8 to 2048 ints are built element by
+// element, read once and dropped, the sizes drawn like in a real mix where
+// small ones dominate
+template <class Vector>
+static std::size_t HandleRequest(std::minstd_rand &gen) {
+  std::size_t sum = 0;
+  for (int vec = 0; vec < 32; ++vec) {
+    Vector v;
+    int count = 8 << std::min(gen() % 16, gen() % 16) % 9;
+    for (int i = 0; i < count; ++i) v.push_back(i);
+    sum += static_cast<std::size_t>(v[v.size() / 2]);
+  }
+  return sum;
+}
+
+template <class Vector>
+static void BM_Requests(benchmark::State &state) {
+  constexpr bool kPooled =
+      std::is_same_v<typename Vector::allocator_type,
+                     s21::recycling_allocator<typename Vector::value_type>>;
+  std::minstd_rand gen(static_cast<unsigned>(state.thread_index()) + 1);
+  std::size_t allocations = bench::heap_allocations;
+  std::size_t base_bytes = bench::peak_heap_bytes = bench::heap_bytes;
+  // The threads start the loop together, what the pool holds from earlier
+  // runs is given back before
+  if (kPooled && state.thread_index() == 0) {
+    s21::recycling_pool::trim();
+    s21::recycling_pool::reset_peak();
+    base_bytes = s21::recycling_pool::stats().upstream_bytes;
+  }
+  for (auto _ : state) benchmark::DoNotOptimize(HandleRequest<Vector>(gen));
+  state.counters["heap_allocs_per_request"] = benchmark::Counter(
+      static_cast<double>(bench::heap_allocations - allocations),
+      benchmark::Counter::kAvgIterations);
+  // The heap peaks of the threads add up, the pool has one of its own
+  if (!kPooled) {
+    state.counters["peak_bytes"] =
+        static_cast<double>(bench::peak_heap_bytes - base_bytes);
+  } else if (state.thread_index() == 0) {
+    state.counters["peak_bytes"] = static_cast<double>(
+        s21::recycling_pool::stats().peak_upstream_bytes - base_bytes);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_Requests, s21::vector<int>)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Requests, s21::recycling_vector<int>)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+// Producer/consumer: batches of buffers built here are dropped by another
+// thread, with the pool they travel back through its shared lists
+template <class Vector>
+static void BM_HandOff(benchmark::State &state) {
+  std::mutex mutex;
+  std::condition_variable changed;
+  s21::vector<s21::vector<Vector>> queue;
+  bool done = false;
+  std::thread consumer([&] {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+      changed.wait(lock, [&] { return done || !queue.empty(); });
+      if (queue.empty()) return;
+      auto batches = std::move(queue);
+      queue = {};
+      changed.notify_all();
+      lock.unlock();
+      batches.clear();
+      lock.lock();
+    }
+  });
+  std::size_t allocations = bench::heap_allocations;
+  for (auto _ : state) {
+    s21::vector<Vector> batch;
+    batch.reserve(64);
+    for (int vec = 0; vec < 64; ++vec) {
+      Vector v;
+      for (int i = 0; i < 256; ++i) v.push_back(i);
+      batch.push_back(std::move(v));
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    changed.wait(lock, [&] { return queue.size() < 4; });
+    queue.push_back(std::move(batch));
+    changed.notify_all();
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    done = true;
+  }
+  changed.notify_all();
+  consumer.join();
+  // Of the producer, the consumer only frees
+  state.counters["heap_allocs_per_batch"] = benchmark::Counter(
+      static_cast<double>(bench::heap_allocations - allocations),
+      benchmark::Counter::kAvgIterations);
+  state.SetItemsProcessed(state.iterations() * 64);
+}
+BENCHMARK_TEMPLATE(BM_HandOff, s21::vector<int>)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_HandOff, s21::recycling_vector<int>)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include "vector.h"
+
+namespace {
+// Owning handle, identical in both flavours except for the opt-in below
+template <bool Relocatable>
+struct Handle {
+  std::unique_ptr<int> value;
+  explicit Handle(int v) : value{std::make_unique<int>(v)} {}
+};
+
+using RelocatableHandle = Handle<true>;
+using PlainHandle = Handle<false>;
+}  // namespace
+
+template <>
+struct s21::is_trivially_relocatable<RelocatableHandle> : std::true_type {};
+
+template <class Vector>
+static void BM_PushBack(benchmark::State &state) {
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    Vector v;
+    for (int i = 0; i < count; ++i) v.push_back(typename Vector::value_type(i));
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(BM_PushBack, std::vector<int>)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_PushBack, s21::vector<int>)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_PushBack, s21::vector<PlainHandle>)
+    ->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_PushBack, s21::vector<RelocatableHandle>)
+    ->Range(1 << 10, 1 << 18);
+
+template <class Vector>
+static void BM_InsertMiddle(benchmark::State &state) {
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    Vector v;
+    for (int i = 0; i < count; ++i)
+      v.insert(v.begin() + v.size() / 2, typename Vector::value_type(i));
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(BM_InsertMiddle, std::vector<int>)->Range(1 << 8, 1 << 14);
+BENCHMARK_TEMPLATE(BM_InsertMiddle, s21::vector<int>)->Range(1 << 8, 1 << 14);
+BENCHMARK_TEMPLATE(BM_InsertMiddle, s21::vector<PlainHandle>)
+    ->Range(1 << 8, 1 << 14);
+BENCHMARK_TEMPLATE(BM_InsertMiddle, s21::vector<RelocatableHandle>)
+    ->Range(1 << 8, 1 << 14);
+
+BENCHMARK_MAIN();
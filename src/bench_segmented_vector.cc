@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+
+#include "segmented_vector.h"
+#include "vector.h"
+
+// segmented_vector against s21::vector: appending, random reads and full
+// scans, the latter through iterators and chunk by chunk.
+
+namespace {
+
+template <class Container>
+Container Filled(std::size_t count) {
+  Container c;
+  for (std::size_t i = 0; i < count; ++i) c.push_back(i);
+  return c;
+}
+
+s21::vector<std::size_t> Indices(std::size_t count) {
+  std::mt19937_64 rng(42);
+  std::uniform_int_distribution<std::size_t> dist(0, count - 1);
+  s21::vector<std::size_t> indices(4096);
+  for (std::size_t &i : indices) i = dist(rng);
+  return indices;
+}
+
+using Segmented = s21::segmented_vector<std::uint64_t>;
+using Contiguous = s21::vector<std::uint64_t>;
+
+}  // namespace
+
+template <class Container>
+static void BM_PushBack(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  for (auto _ : state) {
+    Container c;
+    for (std::size_t i = 0; i < count; ++i) c.push_back(i);
+    benchmark::DoNotOptimize(c.back());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(BM_PushBack, Segmented)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_PushBack, Contiguous)->Range(1 << 10, 1 << 22);
+
+template <class Container>
+static void BM_RandomAccess(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  const Container c = Filled<Container>(count);
+  const s21::vector<std::size_t> indices = Indices(count);
+  for (auto _ : state) {
+    std::uint64_t sum = 0;
+    for (std::size_t i : indices) sum += c[i];
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * indices.size());
+}
+BENCHMARK_TEMPLATE(BM_RandomAccess, Segmented)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_RandomAccess, Contiguous)->Range(1 << 10, 1 << 22);
+
+template <class Container>
+static void BM_IteratorScan(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  const Container c = Filled<Container>(count);
+  for (auto _ : state) {
+    std::uint64_t sum = 0;
+    for (std::uint64_t x : c) sum += x;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(BM_IteratorScan, Segmented)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_IteratorScan, Contiguous)->Range(1 << 10, 1 << 22);
+
+// The same sum over the contiguous runs of for_each_chunk()
+static void BM_ChunkScan(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  const Segmented c = Filled<Segmented>(count);
+  for (auto _ : state) {
+    std::uint64_t sum = 0;
+    c.for_each_chunk([&sum](const std::uint64_t *first,
+                            const std::uint64_t *last) {
+      for (; first != last; ++first) sum += *first;
+    });
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ChunkScan)->Range(1 << 10, 1 << 22);
+
+BENCHMARK_MAIN();
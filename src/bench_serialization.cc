@@ -0,0 +1,135 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "serialization.h"
+
+// Throughput of serializing an s21::vector<std::uint64_t> into memory and
+// into a temporary file, and of reading it back: the bulk path, the byte
+// swapping path and the element at a time loop it replaces.
+
+namespace {
+
+using Bytes = s21::vector<unsigned char>;
+
+constexpr auto kForeign =
+    s21::serial::byte_order::native == s21::serial::byte_order::little
+        ? s21::serial::byte_order::big
+        : s21::serial::byte_order::little;
+
+s21::vector<std::uint64_t> Values(std::size_t count) {
+  s21::vector<std::uint64_t> values;
+  values.reserve(count);
+  for (std::uint64_t i = 0; i < count; ++i) values.push_back(i * 31);
+  return values;
+}
+
+void SetBytes(benchmark::State &state) {
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          sizeof(std::uint64_t));
+}
+
+}  // namespace
+
+template <s21::serial::byte_order Order>
+static void BM_WriteMemory(benchmark::State &state) {
+  const auto values = Values(state.range(0));
+  Bytes bytes;
+  for (auto _ : state) {
+    bytes.clear();
+    s21::serial::memory_sink sink(bytes);
+    s21::serial::writer(sink, Order).write(values);
+    benchmark::DoNotOptimize(bytes.data());
+  }
+  SetBytes(state);
+}
+BENCHMARK_TEMPLATE(BM_WriteMemory, s21::serial::byte_order::native)
+    ->Range(1 << 12, 1 << 22);
+BENCHMARK_TEMPLATE(BM_WriteMemory, kForeign)->Range(1 << 12, 1 << 22);
+
+// The hand-rolled loop: one sink call per element
+static void BM_WriteMemoryPerElement(benchmark::State &state) {
+  const auto values = Values(state.range(0));
+  Bytes bytes;
+  for (auto _ : state) {
+    bytes.clear();
+    s21::serial::memory_sink sink(bytes);
+    s21::serial::writer out(sink);
+    out.write(static_cast<std::uint64_t>(values.size()));
+    for (std::uint64_t value : values) out.write(value);
+    benchmark::DoNotOptimize(bytes.data());
+  }
+  SetBytes(state);
+}
+BENCHMARK(BM_WriteMemoryPerElement)->Range(1 << 12, 1 << 22);
+
+template <s21::serial::byte_order Order>
+static void BM_ReadMemory(benchmark::State &state) {
+  Bytes bytes;
+  s21::serial::memory_sink sink(bytes);
+  s21::serial::writer(sink, Order).write(Values(state.range(0)));
+  s21::vector<std::uint64_t> values;
+  for (auto _ : state) {
+    s21::serial::memory_source source(bytes);
+    s21::serial::reader(source, Order).read(values);
+    benchmark::DoNotOptimize(values.data());
+  }
+  SetBytes(state);
+}
+BENCHMARK_TEMPLATE(BM_ReadMemory, s21::serial::byte_order::native)
+    ->Range(1 << 12, 1 << 22);
+BENCHMARK_TEMPLATE(BM_ReadMemory, kForeign)->Range(1 << 12, 1 << 22);
+
+// A stream of unknown length, 4096 elements per chunk. The vector is
+// reused like above; a fresh one mostly measures page faults of the growth
+static void BM_ReadMemoryChunks(benchmark::State &state) {
+  Bytes bytes;
+  s21::serial::memory_sink sink(bytes);
+  s21::serial::writer(sink).write_chunked(Values(state.range(0)), 4096);
+  s21::vector<std::uint64_t> values;
+  for (auto _ : state) {
+    values.clear();
+    s21::serial::memory_source source(bytes);
+    s21::serial::reader(source).read_chunks(values);
+    benchmark::DoNotOptimize(values.data());
+  }
+  SetBytes(state);
+}
+BENCHMARK(BM_ReadMemoryChunks)->Range(1 << 12, 1 << 22);
+
+static void BM_WriteFile(benchmark::State &state) {
+  const auto values = Values(state.range(0));
+  std::FILE *file = std::tmpfile();
+  for (auto _ : state) {
+    std::rewind(file);
+    s21::serial::file_sink sink(file);
+    s21::serial::writer(sink).write(values);
+    std::fflush(file);
+  }
+  std::fclose(file);
+  SetBytes(state);
+}
+BENCHMARK(BM_WriteFile)->Range(1 << 12, 1 << 22);
+
+static void BM_ReadFile(benchmark::State &state) {
+  std::FILE *file = std::tmpfile();
+  {
+    s21::serial::file_sink sink(file);
+    s21::serial::writer(sink).write(Values(state.range(0)));
+    std::fflush(file);
+  }
+  s21::vector<std::uint64_t> values;
+  for (auto _ : state) {
+    std::rewind(file);
+    s21::serial::file_source source(file);
+    s21::serial::reader(source).read(values);
+    benchmark::DoNotOptimize(values.data());
+  }
+  std::fclose(file);
+  SetBytes(state);
+}
+BENCHMARK(BM_ReadFile)->Range(1 << 12, 1 << 22);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+
+#include "simd_algorithm.h"
+
+// The s21::simd scans per instruction set, the first argument picks it
+// (0 scalar, 1 SSE4.2, 2 AVX2). The scalar versions are whatever the
+// compiler makes of a plain loop at -O3. Sizes fit L1, L2 and DRAM.
+
+namespace {
+
+template <class T>
+s21::vector<T> Random(std::size_t size) {
+  std::mt19937 engine(42);
+  std::uniform_int_distribution<int> value(-1000, 1000);
+  s21::vector<T> vec;
+  vec.reserve(size);
+  for (std::size_t i = 0; i < size; ++i)
+    vec.push_back(static_cast<T>(value(engine)));
+  return vec;
+}
+
+bool UseIsa(benchmark::State &state) {
+  auto level = static_cast<s21::simd::isa>(state.range(0));
+  if (s21::simd::set_isa(level) != level) {
+    state.SkipWithError("instruction set not supported by this CPU");
+    return false;
+  }
+  state.SetLabel(s21::simd::isa_name(level));
+  return true;
+}
+
+}  // namespace
+
+template <class T>
+static void BM_Find(benchmark::State &state) {
+  if (!UseIsa(state)) return;
+  auto vec = Random<T>(state.range(1));
+  // Absent, so the whole vector is scanned
+  for (auto _ : state) benchmark::DoNotOptimize(s21::simd::find(vec, 5000));
+  state.SetItemsProcessed(state.iterations() * vec.size());
+}
+
+template <class T>
+static void BM_Count(benchmark::State &state) {
+  if (!UseIsa(state)) return;
+  auto vec = Random<T>(state.range(1));
+  for (auto _ : state) benchmark::DoNotOptimize(s21::simd::count(vec, 7));
+  state.SetItemsProcessed(state.iterations() * vec.size());
+}
+
+template <class T>
+static void BM_Min(benchmark::State &state) {
+  if (!UseIsa(state)) return;
+  auto vec = Random<T>(state.range(1));
+  for (auto _ : state) benchmark::DoNotOptimize(s21::simd::min(vec));
+  state.SetItemsProcessed(state.iterations() * vec.size());
+}
+
+template <class T>
+static void BM_Sum(benchmark::State &state) {
+  if (!UseIsa(state)) return;
+  auto vec = Random<T>(state.range(1));
+  for (auto _ : state) benchmark::DoNotOptimize(s21::simd::sum(vec));
+  state.SetItemsProcessed(state.iterations() * vec.size());
+}
+
+// Half of the elements pass, the worst case for a branchy filter
+template <class T>
+static void BM_Filter(benchmark::State &state) {
+  if (!UseIsa(state)) return;
+  auto vec = Random<T>(state.range(1));
+  s21::vector<T> out;
+  for (auto _ : state) {
+    out.clear();
+    s21::simd::filter(vec, s21::simd::compare::less, 0, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * vec.size());
+}
+
+#define SIMD_BENCHMARKS(T)                                                 \
+  BENCHMARK_TEMPLATE(BM_Find, T)->ArgsProduct(                             \
+      {{0, 1, 2}, {1 << 10, 1 << 16, 1 << 22}});                           \
+  BENCHMARK_TEMPLATE(BM_Count, T)->ArgsProduct(                            \
+      {{0, 1, 2}, {1 << 10, 1 << 16, 1 << 22}});                           \
+  BENCHMARK_TEMPLATE(BM_Min, T)->ArgsProduct(                              \
+      {{0, 1, 2}, {1 << 10, 1 << 16, 1 << 22}});                           \
+  BENCHMARK_TEMPLATE(BM_Sum, T)->ArgsProduct(                              \
+      {{0, 1, 2}, {1 << 10, 1 << 16, 1 << 22}});                           \
+  BENCHMARK_TEMPLATE(BM_Filter, T)->ArgsProduct(                           \
+      {{0, 1, 2}, {1 << 10, 1 << 16, 1 << 22}})
+
+SIMD_BENCHMARKS(std::int32_t);
+SIMD_BENCHMARKS(float);
+SIMD_BENCHMARKS(double);
+
+BENCHMARK_MAIN();
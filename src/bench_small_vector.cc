@@ -0,0 +1,50 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "bench_alloc_counter.h"
+#include "small_vector.h"
+#include "vector.h"
+
+// Builds many short lived vectors of state.range(0) elements
+template <class Vector>
+static void BM_SmallFill(benchmark::State &state) {
+  const int count = static_cast<int>(state.range(0));
+  std::size_t before = bench::heap_allocations;
+  for (auto _ : state) {
+    Vector v;
+    for (int i = 0; i < count; ++i) v.push_back(typename Vector::value_type(i));
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.counters["heap_allocs_per_vector"] = benchmark::Counter(
+      static_cast<double>(bench::heap_allocations - before),
+      benchmark::Counter::kAvgIterations);
+}
+BENCHMARK_TEMPLATE(BM_SmallFill, s21::vector<int>)->DenseRange(1, 8)->Arg(16);
+BENCHMARK_TEMPLATE(BM_SmallFill, s21::small_vector<int, 8>)
+    ->DenseRange(1, 8)
+    ->Arg(16);
+
+struct Point {
+  double x = 0;
+  double y = 0;
+  Point(int v) : x(v), y(v) {}
+};
+
+BENCHMARK_TEMPLATE(BM_SmallFill, s21::vector<Point>)->Arg(4)->Arg(8);
+BENCHMARK_TEMPLATE(BM_SmallFill, s21::small_vector<Point, 8>)->Arg(4)->Arg(8);
+
+// Vectors are copied around as values, e.g. returned from lookups
+template <class Vector>
+static void BM_SmallCopy(benchmark::State &state) {
+  Vector source;
+  for (int i = 0; i < state.range(0); ++i) source.push_back(i);
+  for (auto _ : state) {
+    Vector copy(source);
+    benchmark::DoNotOptimize(copy.data());
+  }
+}
+BENCHMARK_TEMPLATE(BM_SmallCopy, s21::vector<int>)->Arg(4)->Arg(8);
+BENCHMARK_TEMPLATE(BM_SmallCopy, s21::small_vector<int, 8>)->Arg(4)->Arg(8);
+
+BENCHMARK_MAIN();
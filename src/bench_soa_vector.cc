@@ -0,0 +1,142 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include "soa_vector.h"
+#include "vector.h"
+
+// An s21::vector of a 48 byte particle struct against the same fields as a
+// soa_vector: a scan of one field, an update of three fields, and whole
+// rows read through the tuple proxies.
+
+namespace {
+
+struct Particle {
+  float x, y, z;
+  float vx, vy, vz;
+  double mass;
+  double charge;
+  std::uint32_t id;
+  std::uint32_t flags;
+};
+
+using Rows = s21::vector<Particle>;
+using Columns = s21::soa_vector<float, float, float, float, float, float,
+                                double, double, std::uint32_t,
+                                std::uint32_t>;
+
+Rows MakeRows(std::size_t count) {
+  Rows rows;
+  rows.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    float f = static_cast<float>(i);
+    rows.push_back(Particle{f, f, f, 1, 2, 3, f * 0.5, 1.0,
+                            static_cast<std::uint32_t>(i), 0});
+  }
+  return rows;
+}
+
+Columns MakeColumns(std::size_t count) {
+  Columns columns;
+  columns.reserve(count);
+  for (const Particle &p : MakeRows(count))
+    columns.emplace_back(p.x, p.y, p.z, p.vx, p.vy, p.vz, p.mass, p.charge,
+                         p.id, p.flags);
+  return columns;
+}
+
+}  // namespace
+
+static void BM_RowsSumField(benchmark::State &state) {
+  const Rows rows = MakeRows(state.range(0));
+  for (auto _ : state) {
+    double sum = 0;
+    for (const Particle &p : rows) sum += p.mass;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RowsSumField)->Range(1 << 10, 1 << 22);
+
+static void BM_ColumnsSumField(benchmark::State &state) {
+  const Columns columns = MakeColumns(state.range(0));
+  for (auto _ : state) {
+    double sum = 0;
+    for (double mass : columns.data<6>()) sum += mass;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ColumnsSumField)->Range(1 << 10, 1 << 22);
+
+// x += vx over every particle: two of ten fields
+static void BM_RowsUpdate(benchmark::State &state) {
+  Rows rows = MakeRows(state.range(0));
+  for (auto _ : state) {
+    for (Particle &p : rows) p.x += p.vx;
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RowsUpdate)->Range(1 << 10, 1 << 22);
+
+static void BM_ColumnsUpdate(benchmark::State &state) {
+  Columns columns = MakeColumns(state.range(0));
+  for (auto _ : state) {
+    float *x = columns.data<0>().data();
+    const float *vx = columns.data<3>().data();
+    for (std::size_t i = 0, n = columns.size(); i < n; ++i) x[i] += vx[i];
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ColumnsUpdate)->Range(1 << 10, 1 << 22);
+
+// Every field of every row, where the struct layout is at its best
+static void BM_RowsWholeRow(benchmark::State &state) {
+  const Rows rows = MakeRows(state.range(0));
+  for (auto _ : state) {
+    double sum = 0;
+    for (const Particle &p : rows)
+      sum += p.x + p.y + p.z + p.vx + p.vy + p.vz + p.mass + p.charge +
+             p.id + p.flags;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RowsWholeRow)->Range(1 << 10, 1 << 22);
+
+static void BM_ColumnsWholeRow(benchmark::State &state) {
+  const Columns columns = MakeColumns(state.range(0));
+  for (auto _ : state) {
+    double sum = 0;
+    for (auto [x, y, z, vx, vy, vz, mass, charge, id, flags] : columns)
+      sum += x + y + z + vx + vy + vz + mass + charge + id + flags;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ColumnsWholeRow)->Range(1 << 10, 1 << 22);
+
+// Both reserve first, like MakeRows()
+static void BM_RowsPushBack(benchmark::State &state) {
+  for (auto _ : state) benchmark::DoNotOptimize(MakeRows(state.range(0)));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RowsPushBack)->Range(1 << 10, 1 << 18);
+
+static void BM_ColumnsPushBack(benchmark::State &state) {
+  const Rows rows = MakeRows(state.range(0));
+  for (auto _ : state) {
+    Columns columns;
+    columns.reserve(rows.size());
+    for (const Particle &p : rows)
+      columns.emplace_back(p.x, p.y, p.z, p.vx, p.vy, p.vz, p.mass, p.charge,
+                           p.id, p.flags);
+    benchmark::DoNotOptimize(columns.data<0>().data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ColumnsPushBack)->Range(1 << 10, 1 << 18);
+
+BENCHMARK_MAIN();
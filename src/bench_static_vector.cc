@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+#include "static_vector.h"
+#include "vector.h"
+
+// A bounded list built from scratch on a hot path, e.g. the orders matched
+// by one message. s21::vector pays for reserve() up front and the free at
+// the end, static_vector's reserve() is only a bounds check. Every build is
+// timed on its own and the percentiles are reported, since a rare slow call
+// into the allocator is what hurts, not the mean.
+template <class Vector>
+static Vector Build(int count) {
+  Vector v;
+  v.reserve(static_cast<typename Vector::size_type>(count));
+  for (int i = 0; i < count; ++i) v.push_back(i);
+  return v;
+}
+
+template <class Vector>
+static void BM_BuildLatency(benchmark::State &state) {
+  using clock = std::chrono::steady_clock;
+  const int count = static_cast<int>(state.range(0));
+  std::vector<double> samples;
+  samples.reserve(1 << 20);
+  for (auto _ : state) {
+    auto start = clock::now();
+    {
+      Vector v = Build<Vector>(count);
+      benchmark::DoNotOptimize(v.data());
+    }
+    auto stop = clock::now();
+    if (samples.size() < samples.capacity())
+      samples.push_back(
+          std::chrono::duration<double, std::nano>(stop - start).count());
+  }
+  if (samples.empty()) return;
+  std::sort(samples.begin(), samples.end());
+  auto percentile = [&samples](double p) {
+    return samples[static_cast<std::size_t>(p * (samples.size() - 1))];
+  };
+  state.counters["p50_ns"] = percentile(0.5);
+  state.counters["p99_ns"] = percentile(0.99);
+  state.counters["p99.9_ns"] = percentile(0.999);
+  state.counters["max_ns"] = samples.back();
+}
+BENCHMARK_TEMPLATE(BM_BuildLatency, s21::vector<int>)->Arg(8)->Arg(64);
+BENCHMARK_TEMPLATE(BM_BuildLatency, s21::static_vector<int, 64>)
+    ->Arg(8)
+    ->Arg(64);
+
+BENCHMARK_MAIN();
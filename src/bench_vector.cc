@@ -0,0 +1,206 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "vector.h"
+
+// s21::vector next to std::vector for the common operations, each over
+// int, a 64 byte POD and std::string. Run the bench_json target to get the
+// results as JSON for comparing revisions.
+
+namespace {
+
+struct Pod64 {
+  std::uint64_t words[8];
+};
+
+template <class T>
+T Make(std::size_t i);
+
+template <>
+int Make<int>(std::size_t i) {
+  return static_cast<int>(i);
+}
+
+template <>
+Pod64 Make<Pod64>(std::size_t i) {
+  Pod64 pod{};
+  for (auto &word : pod.words) word = i;
+  return pod;
+}
+
+template <>
+std::string Make<std::string>(std::size_t i) {
+  // Longer than the small string buffer, so every string owns heap memory
+  return "element number " + std::to_string(i) + " of the benchmark";
+}
+
+template <class Vector>
+Vector Filled(std::size_t count) {
+  Vector v;
+  v.reserve(count);
+  for (std::size_t i = 0; i < count; ++i)
+    v.push_back(Make<typename Vector::value_type>(i));
+  return v;
+}
+
+template <class T>
+std::uint64_t Touch(const T &value) {
+  if constexpr (std::is_same_v<T, int>) {
+    return static_cast<std::uint64_t>(value);
+  } else if constexpr (std::is_same_v<T, Pod64>) {
+    return value.words[0];
+  } else {
+    return value.size();
+  }
+}
+
+}  // namespace
+
+template <class Vector>
+static void BM_PushBack(benchmark::State &state) {
+  using T = typename Vector::value_type;
+  const std::size_t count = state.range(0);
+  for (auto _ : state) {
+    Vector v;
+    for (std::size_t i = 0; i < count; ++i) v.push_back(Make<T>(i));
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <class Vector>
+static void BM_ReserveFill(benchmark::State &state) {
+  using T = typename Vector::value_type;
+  const std::size_t count = state.range(0);
+  for (auto _ : state) {
+    Vector v;
+    v.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) v.push_back(Make<T>(i));
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <class Vector>
+static void BM_InsertFront(benchmark::State &state) {
+  using T = typename Vector::value_type;
+  const std::size_t count = state.range(0);
+  for (auto _ : state) {
+    Vector v;
+    for (std::size_t i = 0; i < count; ++i) v.insert(v.begin(), Make<T>(i));
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <class Vector>
+static void BM_InsertMiddle(benchmark::State &state) {
+  using T = typename Vector::value_type;
+  const std::size_t count = state.range(0);
+  for (auto _ : state) {
+    Vector v;
+    for (std::size_t i = 0; i < count; ++i)
+      v.insert(v.begin() + v.size() / 2, Make<T>(i));
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <class Vector>
+static void BM_EraseMiddle(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  for (auto _ : state) {
+    state.PauseTiming();
+    Vector v = Filled<Vector>(count);
+    state.ResumeTiming();
+    while (!v.empty()) v.erase(v.begin() + v.size() / 2);
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <class Vector>
+static void BM_Copy(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  Vector source = Filled<Vector>(count);
+  for (auto _ : state) {
+    Vector copy(source);
+    benchmark::DoNotOptimize(copy.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <class Vector>
+static void BM_Move(benchmark::State &state) {
+  Vector a = Filled<Vector>(state.range(0));
+  Vector b;
+  for (auto _ : state) {
+    b = std::move(a);
+    a = std::move(b);
+    benchmark::DoNotOptimize(a.data());
+  }
+}
+
+template <class Vector>
+static void BM_Iterate(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  Vector v = Filled<Vector>(count);
+  for (auto _ : state) {
+    std::uint64_t sum = 0;
+    for (const auto &value : v) sum += Touch(value);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <class Vector>
+static void BM_ShrinkToFit(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  for (auto _ : state) {
+    state.PauseTiming();
+    Vector v = Filled<Vector>(count);
+    v.reserve(count * 2);
+    state.ResumeTiming();
+    v.shrink_to_fit();
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+#define VECTOR_BENCHMARKS(T)                                                 \
+  BENCHMARK_TEMPLATE(BM_PushBack, std::vector<T>)->Range(1 << 8, 1 << 16);   \
+  BENCHMARK_TEMPLATE(BM_PushBack, s21::vector<T>)->Range(1 << 8, 1 << 16);   \
+  BENCHMARK_TEMPLATE(BM_ReserveFill, std::vector<T>)                         \
+      ->Range(1 << 8, 1 << 16);                                              \
+  BENCHMARK_TEMPLATE(BM_ReserveFill, s21::vector<T>)                         \
+      ->Range(1 << 8, 1 << 16);                                              \
+  BENCHMARK_TEMPLATE(BM_InsertFront, std::vector<T>)                         \
+      ->Range(1 << 6, 1 << 12);                                              \
+  BENCHMARK_TEMPLATE(BM_InsertFront, s21::vector<T>)                         \
+      ->Range(1 << 6, 1 << 12);                                              \
+  BENCHMARK_TEMPLATE(BM_InsertMiddle, std::vector<T>)                        \
+      ->Range(1 << 6, 1 << 12);                                              \
+  BENCHMARK_TEMPLATE(BM_InsertMiddle, s21::vector<T>)                        \
+      ->Range(1 << 6, 1 << 12);                                              \
+  BENCHMARK_TEMPLATE(BM_EraseMiddle, std::vector<T>)                         \
+      ->Range(1 << 6, 1 << 12);                                              \
+  BENCHMARK_TEMPLATE(BM_EraseMiddle, s21::vector<T>)                         \
+      ->Range(1 << 6, 1 << 12);                                              \
+  BENCHMARK_TEMPLATE(BM_Copy, std::vector<T>)->Range(1 << 8, 1 << 16);       \
+  BENCHMARK_TEMPLATE(BM_Copy, s21::vector<T>)->Range(1 << 8, 1 << 16);       \
+  BENCHMARK_TEMPLATE(BM_Move, std::vector<T>)->Arg(1 << 10);                 \
+  BENCHMARK_TEMPLATE(BM_Move, s21::vector<T>)->Arg(1 << 10);                 \
+  BENCHMARK_TEMPLATE(BM_Iterate, std::vector<T>)->Range(1 << 8, 1 << 16);    \
+  BENCHMARK_TEMPLATE(BM_Iterate, s21::vector<T>)->Range(1 << 8, 1 << 16);    \
+  BENCHMARK_TEMPLATE(BM_ShrinkToFit, std::vector<T>)                         \
+      ->Range(1 << 8, 1 << 16);                                              \
+  BENCHMARK_TEMPLATE(BM_ShrinkToFit, s21::vector<T>)->Range(1 << 8, 1 << 16)
+
+VECTOR_BENCHMARKS(int);
+VECTOR_BENCHMARKS(Pod64);
+VECTOR_BENCHMARKS(std::string);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,438 @@
+#ifndef CONTAINERS_CPP_BIT_VECTOR_H
+#define CONTAINERS_CPP_BIT_VECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "hardening.h"
+#include "simd_algorithm.h"
+#include "vector.h"
+
+namespace s21 {
+
+namespace detail {
+
+inline std::size_t PopcountWordsScalar(const std::uint64_t *words,
+                                       std::size_t count) noexcept {
+  std::size_t ones = 0;
+  for (std::size_t i = 0; i < count; ++i)
+    ones += static_cast<std::size_t>(__builtin_popcountll(words[i]));
+  return ones;
+}
+
+#if S21_SIMD_X86
+// The same loop built for the popcnt instruction, without -mpopcnt the
+// builtin is a call into libgcc
+S21_SIMD_SSE4 inline std::size_t PopcountWordsNative(
+    const std::uint64_t *words, std::size_t count) noexcept {
+  std::size_t ones = 0;
+  for (std::size_t i = 0; i < count; ++i)
+    ones += static_cast<std::size_t>(__builtin_popcountll(words[i]));
+  return ones;
+}
+#endif
+
+// Ones in words[0, count), with popcnt when simd::active_isa() allows it
+inline std::size_t PopcountWords(const std::uint64_t *words,
+                                 std::size_t count) noexcept {
+#if S21_SIMD_X86
+  if (simd::active_isa() != simd::isa::scalar)
+    return PopcountWordsNative(words, count);
+#endif
+  return PopcountWordsScalar(words, count);
+}
+
+// Position of the set bit of word with rank k, k < popcount(word)
+inline unsigned SelectInWord(std::uint64_t word, std::size_t k) noexcept {
+  for (; k; --k) word &= word - 1;
+  return static_cast<unsigned>(__builtin_ctzll(word));
+}
+
+}  // namespace detail
+
+// Sequence of bits packed 64 to a std::uint64_t word: one bit per flag
+// instead of the byte of s21::vector<bool>, and counts, searches and the
+// bulk logical operations work on whole words. The bits past size() in the
+// last word are always zero.
+class bit_vector {
+ public:
+  // Member types
+  using value_type = bool;
+  using word_type = std::uint64_t;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using const_reference = bool;
+
+  static constexpr size_type word_bits = 64;
+  // What the searches return when there is no such bit
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  // Proxy for a single bit of a non-const bit_vector
+  class reference {
+   public:
+    operator bool() const noexcept { return *word_ & mask_; }
+
+    reference &operator=(bool value) noexcept {
+      *word_ = value ? *word_ | mask_ : *word_ & ~mask_;
+      return *this;
+    }
+
+    reference &operator=(const reference &other) noexcept {
+      return *this = static_cast<bool>(other);
+    }
+
+    void flip() noexcept { *word_ ^= mask_; }
+
+   private:
+    friend class bit_vector;
+
+    reference(word_type *word, word_type mask) noexcept
+        : word_(word), mask_(mask) {}
+
+    word_type *word_;
+    word_type mask_;
+  };
+
+  class const_iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = bool;
+    using difference_type = std::ptrdiff_t;
+    using reference = bool;
+    using pointer = void;
+
+    const_iterator() noexcept = default;
+
+    bool operator*() const noexcept { return (*vec_)[pos_]; }
+    bool operator[](difference_type n) const noexcept {
+      return (*vec_)[pos_ + n];
+    }
+
+    const_iterator &operator++() noexcept {
+      ++pos_;
+      return *this;
+    }
+    const_iterator operator++(int) noexcept {
+      return const_iterator(vec_, pos_++);
+    }
+    const_iterator &operator--() noexcept {
+      --pos_;
+      return *this;
+    }
+    const_iterator operator--(int) noexcept {
+      return const_iterator(vec_, pos_--);
+    }
+    const_iterator &operator+=(difference_type n) noexcept {
+      pos_ += n;
+      return *this;
+    }
+    const_iterator &operator-=(difference_type n) noexcept {
+      pos_ -= n;
+      return *this;
+    }
+
+    friend const_iterator operator+(const_iterator it,
+                                    difference_type n) noexcept {
+      return it += n;
+    }
+    friend const_iterator operator+(difference_type n,
+                                    const_iterator it) noexcept {
+      return it += n;
+    }
+    friend const_iterator operator-(const_iterator it,
+                                    difference_type n) noexcept {
+      return it -= n;
+    }
+    friend difference_type operator-(const const_iterator &a,
+                                     const const_iterator &b) noexcept {
+      return static_cast<difference_type>(a.pos_) -
+             static_cast<difference_type>(b.pos_);
+    }
+    friend bool operator==(const const_iterator &a,
+                           const const_iterator &b) noexcept {
+      return a.pos_ == b.pos_;
+    }
+    friend bool operator!=(const const_iterator &a,
+                           const const_iterator &b) noexcept {
+      return a.pos_ != b.pos_;
+    }
+    friend bool operator<(const const_iterator &a,
+                          const const_iterator &b) noexcept {
+      return a.pos_ < b.pos_;
+    }
+    friend bool operator>(const const_iterator &a,
+                          const const_iterator &b) noexcept {
+      return a.pos_ > b.pos_;
+    }
+    friend bool operator<=(const const_iterator &a,
+                           const const_iterator &b) noexcept {
+      return a.pos_ <= b.pos_;
+    }
+    friend bool operator>=(const const_iterator &a,
+                           const const_iterator &b) noexcept {
+      return a.pos_ >= b.pos_;
+    }
+
+   private:
+    friend class bit_vector;
+
+    const_iterator(const bit_vector *vec, size_type pos) noexcept
+        : vec_(vec), pos_(pos) {}
+
+    const bit_vector *vec_ = nullptr;
+    size_type pos_ = 0;
+  };
+
+  using iterator = const_iterator;
+
+ private:
+  vector<word_type> words_;
+  size_type size_ = 0;
+
+  static constexpr size_type WordsFor(size_type bits) noexcept {
+    return (bits + word_bits - 1) / word_bits;
+  }
+
+  static constexpr word_type Mask(size_type pos) noexcept {
+    return word_type{1} << (pos % word_bits);
+  }
+
+  // Clears the bits past size_ in the last word
+  void TrimLast() noexcept {
+    if (size_ % word_bits)
+      words_.back() &= ~word_type{0} >> (word_bits - size_ % word_bits);
+  }
+
+  void CheckSameSize(const bit_vector &other, const char *message) const {
+    if (size_ != other.size_) throw std::invalid_argument(message);
+  }
+
+ public:
+  // Constructors
+  bit_vector() noexcept = default;
+
+  explicit bit_vector(size_type count, bool value = false)
+      : words_(WordsFor(count), value ? ~word_type{0} : word_type{0}),
+        size_(count) {
+    TrimLast();
+  }
+
+  bit_vector(std::initializer_list<bool> init) {
+    reserve(init.size());
+    for (bool bit : init) push_back(bit);
+  }
+
+  // Iterators
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator end() const noexcept { return const_iterator(this, size_); }
+  const_iterator cend() const noexcept { return end(); }
+
+  // Element access
+  bool operator[](size_type pos) const noexcept {
+    S21_VECTOR_ASSERT(pos < size_,
+                      "s21::bit_vector::operator[] The index is out of range");
+    return words_[pos / word_bits] & Mask(pos);
+  }
+
+  reference operator[](size_type pos) noexcept {
+    S21_VECTOR_ASSERT(pos < size_,
+                      "s21::bit_vector::operator[] The index is out of range");
+    return reference(&words_[pos / word_bits], Mask(pos));
+  }
+
+  bool test(size_type pos) const {
+    if (pos >= size_)
+      throw std::out_of_range(
+          "s21::bit_vector::test The index is out of range");
+    return (*this)[pos];
+  }
+
+  bool front() const noexcept { return (*this)[0]; }
+  bool back() const noexcept { return (*this)[size_ - 1]; }
+
+  // The packed words, bit i is bit i % 64 of word i / 64
+  const word_type *data() const noexcept { return words_.data(); }
+  size_type num_words() const noexcept { return words_.size(); }
+
+  // Capacity
+  [[nodiscard]] bool empty() const noexcept { return !size_; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return words_.capacity() * word_bits; }
+  void reserve(size_type bits) { words_.reserve(WordsFor(bits)); }
+  void shrink_to_fit() { words_.shrink_to_fit(); }
+
+  // Modifiers
+  void clear() noexcept {
+    words_.clear();
+    size_ = 0;
+  }
+
+  void push_back(bool value) {
+    if (size_ % word_bits == 0) words_.push_back(0);
+    if (value) words_.back() |= Mask(size_);
+    ++size_;
+  }
+
+  void pop_back() {
+    if (!size_)
+      throw std::length_error(
+          "s21::bit_vector::pop_back Calling pop_back on an empty container");
+    --size_;
+    if (size_ % word_bits == 0) {
+      words_.pop_back();
+    } else {
+      words_.back() &= ~Mask(size_);
+    }
+  }
+
+  void resize(size_type count, bool value = false) {
+    if (count <= size_) {
+      size_ = count;
+      words_.erase(words_.begin() + WordsFor(count), words_.end());
+      TrimLast();
+      return;
+    }
+    if (value && size_ % word_bits)
+      words_.back() |= ~word_type{0} << (size_ % word_bits);
+    words_.insert(words_.end(), WordsFor(count) - words_.size(),
+                  value ? ~word_type{0} : word_type{0});
+    size_ = count;
+    TrimLast();
+  }
+
+  void set(size_type pos, bool value = true) noexcept {
+    (*this)[pos] = value;
+  }
+  void reset(size_type pos) noexcept { (*this)[pos] = false; }
+  void flip(size_type pos) noexcept { (*this)[pos].flip(); }
+
+  // All bits at once
+  void set() noexcept {
+    for (word_type &word : words_) word = ~word_type{0};
+    TrimLast();
+  }
+  void reset() noexcept {
+    for (word_type &word : words_) word = 0;
+  }
+  void flip() noexcept {
+    for (word_type &word : words_) word = ~word;
+    TrimLast();
+  }
+
+  bit_vector &operator&=(const bit_vector &other) {
+    CheckSameSize(other, "s21::bit_vector::operator&= The sizes differ");
+    for (size_type i = 0; i < words_.size(); ++i) words_[i] &= other.words_[i];
+    return *this;
+  }
+
+  bit_vector &operator|=(const bit_vector &other) {
+    CheckSameSize(other, "s21::bit_vector::operator|= The sizes differ");
+    for (size_type i = 0; i < words_.size(); ++i) words_[i] |= other.words_[i];
+    return *this;
+  }
+
+  bit_vector &operator^=(const bit_vector &other) {
+    CheckSameSize(other, "s21::bit_vector::operator^= The sizes differ");
+    for (size_type i = 0; i < words_.size(); ++i) words_[i] ^= other.words_[i];
+    return *this;
+  }
+
+  // Clears the bits set in other
+  bit_vector &and_not(const bit_vector &other) {
+    CheckSameSize(other, "s21::bit_vector::and_not The sizes differ");
+    for (size_type i = 0; i < words_.size(); ++i)
+      words_[i] &= ~other.words_[i];
+    return *this;
+  }
+
+  void swap(bit_vector &other) noexcept {
+    words_.swap(other.words_);
+    std::swap(size_, other.size_);
+  }
+
+  // Counts and searches
+  size_type count() const noexcept {
+    return detail::PopcountWords(words_.data(), words_.size());
+  }
+
+  bool any() const noexcept {
+    for (word_type word : words_)
+      if (word) return true;
+    return false;
+  }
+  bool none() const noexcept { return !any(); }
+  bool all() const noexcept { return count() == size_; }
+
+  // Set bits in [0, pos), pos <= size()
+  size_type rank(size_type pos) const noexcept {
+    S21_VECTOR_ASSERT(pos <= size_,
+                      "s21::bit_vector::rank The index is out of range");
+    size_type ones = detail::PopcountWords(words_.data(), pos / word_bits);
+    if (pos % word_bits)
+      ones += static_cast<size_type>(__builtin_popcountll(
+          words_[pos / word_bits] & (Mask(pos) - 1)));
+    return ones;
+  }
+
+  // Position of the set bit with rank k, the (k + 1)-th one, or npos
+  size_type select(size_type k) const noexcept {
+    for (size_type i = 0; i < words_.size(); ++i) {
+      auto ones = static_cast<size_type>(__builtin_popcountll(words_[i]));
+      if (k < ones) return i * word_bits + detail::SelectInWord(words_[i], k);
+      k -= ones;
+    }
+    return npos;
+  }
+
+  // Position of the first set bit, or npos
+  size_type find_first() const noexcept { return find_next(0); }
+
+  // Position of the first set bit at or after pos, or npos
+  size_type find_next(size_type pos) const noexcept {
+    if (pos >= size_) return npos;
+    size_type i = pos / word_bits;
+    word_type word = words_[i] & ~(Mask(pos) - 1);
+    while (!word) {
+      if (++i == words_.size()) return npos;
+      word = words_[i];
+    }
+    return i * word_bits + static_cast<size_type>(__builtin_ctzll(word));
+  }
+
+  friend bool operator==(const bit_vector &a, const bit_vector &b) noexcept {
+    if (a.size_ != b.size_) return false;
+    for (size_type i = 0; i < a.words_.size(); ++i)
+      if (a.words_[i] != b.words_[i]) return false;
+    return true;
+  }
+
+  friend bool operator!=(const bit_vector &a, const bit_vector &b) noexcept {
+    return !(a == b);
+  }
+};
+
+inline bit_vector operator&(bit_vector a, const bit_vector &b) {
+  return a &= b;
+}
+
+inline bit_vector operator|(bit_vector a, const bit_vector &b) {
+  return a |= b;
+}
+
+inline bit_vector operator^(bit_vector a, const bit_vector &b) {
+  return a ^= b;
+}
+
+inline bit_vector operator~(bit_vector a) noexcept {
+  a.flip();
+  return a;
+}
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_BIT_VECTOR_H
@@ -0,0 +1,408 @@
+#ifndef CONTAINERS_CPP_COMPRESSED_VECTOR_H
+#define CONTAINERS_CPP_COMPRESSED_VECTOR_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "hardening.h"
+#include "vector.h"
+
+namespace s21 {
+
+namespace detail {
+
+// Bit packing of the compressed_vector blocks: 128 values of Bits bits in
+// 2 * Bits words, value i in bits [i * Bits, (i + 1) * Bits)
+
+inline constexpr std::size_t kPackedBlock = 128;
+
+inline unsigned BitWidth(std::uint64_t value) noexcept {
+  return value ? 64 - static_cast<unsigned>(__builtin_clzll(value)) : 0;
+}
+
+inline void PackBlock(const std::uint64_t *values, unsigned bits,
+                      std::uint64_t *words) noexcept {
+  if (!bits) return;
+  for (std::size_t i = 0; i < 2 * bits; ++i) words[i] = 0;
+  for (std::size_t i = 0; i < kPackedBlock; ++i) {
+    std::size_t bit = i * bits;
+    unsigned offset = bit % 64;
+    words[bit / 64] |= values[i] << offset;
+    if (offset + bits > 64) words[bit / 64 + 1] |= values[i] >> (64 - offset);
+  }
+}
+
+// Value I of the block, the word and the shifts are constants
+template <unsigned Bits, std::size_t I>
+std::uint64_t ExtractPacked(const std::uint64_t *words) noexcept {
+  constexpr std::uint64_t kMask = ~std::uint64_t{0} >> (64 - Bits);
+  constexpr std::size_t kWord = I * Bits / 64;
+  constexpr unsigned kOffset = I * Bits % 64;
+  if constexpr (kOffset + Bits <= 64) {
+    return (words[kWord] >> kOffset) & kMask;
+  } else {
+    return ((words[kWord] >> kOffset) |
+            (words[kWord + 1] << (64 - kOffset))) &
+           kMask;
+  }
+}
+
+// Half a block, 64 values in Bits words
+template <unsigned Bits, class T, std::size_t... I>
+void UnpackHalf(const std::uint64_t *words, T *out,
+                std::index_sequence<I...>) noexcept {
+  ((out[I] = static_cast<T>(ExtractPacked<Bits, I>(words))), ...);
+}
+
+template <unsigned Bits, class T>
+void UnpackBlock(const std::uint64_t *words, T *out) noexcept {
+  if constexpr (Bits == 0) {
+    for (std::size_t i = 0; i < kPackedBlock; ++i) out[i] = 0;
+  } else {
+    UnpackHalf<Bits>(words, out, std::make_index_sequence<64>());
+    UnpackHalf<Bits>(words + Bits, out + 64, std::make_index_sequence<64>());
+  }
+}
+
+template <class T>
+using UnpackFunction = void (*)(const std::uint64_t *, T *) noexcept;
+
+// One unpacker per width, picked by the width stored in the block
+template <class T, unsigned... Bits>
+constexpr std::array<UnpackFunction<T>, sizeof...(Bits)> MakeUnpackers(
+    std::integer_sequence<unsigned, Bits...>) noexcept {
+  return {&UnpackBlock<Bits, T>...};
+}
+
+template <class T>
+inline constexpr auto kUnpackers =
+    MakeUnpackers<T>(std::make_integer_sequence<unsigned, 65>());
+
+// A single value of a block of any width
+inline std::uint64_t PackedValue(const std::uint64_t *words, unsigned bits,
+                                 std::size_t pos) noexcept {
+  if (!bits) return 0;
+  std::size_t bit = pos * bits;
+  unsigned offset = bit % 64;
+  std::uint64_t value = words[bit / 64] >> offset;
+  if (offset + bits > 64) value |= words[bit / 64 + 1] << (64 - offset);
+  return value & (~std::uint64_t{0} >> (64 - bits));
+}
+
+}  // namespace detail
+
+// Append-only sequence of unsigned integers compressed in blocks of 128.
+// A full block is stored either frame of reference, as the offsets from
+// its minimum, or for non-decreasing blocks as the differences between
+// neighbours, whichever needs fewer bits, and those are bit-packed. Sorted
+// IDs and timestamps shrink to a few bits per value.
+//
+// A skip index keeps the first value of every block: a random read
+// decodes at most one block, and lower_bound() over sorted data binary
+// searches the index and decodes one block. The values of the last,
+// incomplete block stay uncompressed until it fills up.
+template <class T = std::uint64_t>
+class compressed_vector {
+  static_assert(std::is_same_v<T, std::uint32_t> ||
+                    std::is_same_v<T, std::uint64_t>,
+                "s21::compressed_vector T must be std::uint32_t or "
+                "std::uint64_t");
+
+ public:
+  // Member types
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using const_reference = T;
+
+  static constexpr size_type block_size = detail::kPackedBlock;
+
+ private:
+  enum class Encoding : std::uint8_t { kFrameOfReference, kDelta };
+
+  struct Block {
+    std::uint64_t offset;  // Of the packed words in words_
+    T base;                // The minimum, or the first value for kDelta
+    std::uint8_t bits;
+    Encoding encoding;
+  };
+
+ public:
+  // Forward iterator that decodes a block whenever it enters one
+  class const_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = const T &;
+    using pointer = const T *;
+
+    const_iterator() noexcept = default;
+
+    reference operator*() const noexcept { return buffer_[pos_ % block_size]; }
+    pointer operator->() const noexcept {
+      return &buffer_[pos_ % block_size];
+    }
+
+    const_iterator &operator++() noexcept {
+      if (++pos_ % block_size == 0 && pos_ < vec_->size()) Fill();
+      return *this;
+    }
+
+    const_iterator operator++(int) noexcept {
+      const_iterator old = *this;
+      ++*this;
+      return old;
+    }
+
+    friend bool operator==(const const_iterator &a,
+                           const const_iterator &b) noexcept {
+      return a.pos_ == b.pos_;
+    }
+    friend bool operator!=(const const_iterator &a,
+                           const const_iterator &b) noexcept {
+      return a.pos_ != b.pos_;
+    }
+
+   private:
+    friend class compressed_vector;
+
+    const_iterator(const compressed_vector *vec, size_type pos) noexcept
+        : vec_(vec), pos_(pos) {
+      if (pos_ < vec_->size()) Fill();
+    }
+
+    void Fill() noexcept { vec_->decode_block(pos_ / block_size, buffer_); }
+
+    const compressed_vector *vec_ = nullptr;
+    size_type pos_ = 0;
+    T buffer_[block_size] = {};
+  };
+
+  using iterator = const_iterator;
+
+ private:
+  vector<std::uint64_t> words_;
+  vector<Block> blocks_;
+  vector<T> firsts_;  // The skip index, the first value of every block
+  vector<T> tail_;    // Values of the incomplete last block
+
+  // Encodes the full tail_ as a new block
+  void Seal() {
+    std::uint64_t values[block_size];
+    T min = tail_[0];
+    T max = tail_[0];
+    bool sorted = true;
+    for (size_type i = 1; i < block_size; ++i) {
+      min = std::min(min, tail_[i]);
+      max = std::max(max, tail_[i]);
+      sorted = sorted && tail_[i - 1] <= tail_[i];
+    }
+    unsigned bits = detail::BitWidth(max - min);
+    Encoding encoding = Encoding::kFrameOfReference;
+    T base = min;
+    if (sorted) {
+      T max_delta = 0;
+      for (size_type i = 1; i < block_size; ++i)
+        max_delta = std::max<T>(max_delta, tail_[i] - tail_[i - 1]);
+      if (detail::BitWidth(max_delta) < bits) {
+        bits = detail::BitWidth(max_delta);
+        encoding = Encoding::kDelta;
+        base = tail_[0];
+      }
+    }
+    if (encoding == Encoding::kDelta) {
+      values[0] = 0;
+      for (size_type i = 1; i < block_size; ++i)
+        values[i] = tail_[i] - tail_[i - 1];
+    } else {
+      for (size_type i = 0; i < block_size; ++i) values[i] = tail_[i] - min;
+    }
+    size_type offset = words_.size();
+    words_.insert(words_.end(), 2 * bits, 0);
+    detail::PackBlock(values, bits, words_.data() + offset);
+    blocks_.push_back(Block{offset, base, static_cast<std::uint8_t>(bits),
+                            encoding});
+    firsts_.push_back(tail_[0]);
+    tail_.clear();
+  }
+
+  // The block_size values of a full block
+  void Decode(const Block &block, T *out) const noexcept {
+    detail::kUnpackers<T>[block.bits](words_.data() + block.offset, out);
+    if (block.encoding == Encoding::kDelta) {
+      T sum = block.base;
+      for (size_type i = 0; i < block_size; ++i) out[i] = sum += out[i];
+    } else {
+      for (size_type i = 0; i < block_size; ++i) out[i] += block.base;
+    }
+  }
+
+ public:
+  // Constructors
+  compressed_vector() = default;
+
+  template <class InputIt,
+            class = std::enable_if_t<std::is_convertible_v<
+                typename std::iterator_traits<InputIt>::iterator_category,
+                std::input_iterator_tag>>>
+  compressed_vector(InputIt first, InputIt last) {
+    append(first, last);
+  }
+
+  compressed_vector(std::initializer_list<T> init) {
+    append(init.begin(), init.end());
+  }
+
+  // Iterators
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator end() const noexcept { return const_iterator(this, size()); }
+  const_iterator cend() const noexcept { return end(); }
+
+  // Element access. A read decodes one packed value, and for a delta
+  // block the ones before it
+  T operator[](size_type pos) const noexcept {
+    S21_VECTOR_ASSERT(
+        pos < size(),
+        "s21::compressed_vector::operator[] The index is out of range");
+    size_type b = pos / block_size;
+    if (b == blocks_.size()) return tail_[pos % block_size];
+    const Block &block = blocks_[b];
+    const std::uint64_t *words = words_.data() + block.offset;
+    if (block.encoding == Encoding::kFrameOfReference)
+      return static_cast<T>(
+          block.base +
+          detail::PackedValue(words, block.bits, pos % block_size));
+    // Summing the prefix value by value costs more than the table driven
+    // unpack of the whole block
+    T values[block_size];
+    Decode(block, values);
+    return values[pos % block_size];
+  }
+
+  T at(size_type pos) const {
+    if (pos >= size())
+      throw std::out_of_range(
+          "s21::compressed_vector::at The index is out of range");
+    return (*this)[pos];
+  }
+
+  T front() const noexcept { return (*this)[0]; }
+  T back() const noexcept { return (*this)[size() - 1]; }
+
+  // Writes the values of block b to out, which has room for block_size,
+  // and returns their count: block_size but for the incomplete last block
+  size_type decode_block(size_type b, T *out) const noexcept {
+    S21_VECTOR_ASSERT(
+        b < num_blocks(),
+        "s21::compressed_vector::decode_block The block is out of range");
+    if (b == blocks_.size()) {
+      std::copy(tail_.begin(), tail_.end(), out);
+      return tail_.size();
+    }
+    Decode(blocks_[b], out);
+    return block_size;
+  }
+
+  // Appends all values to out, decoded right into its storage
+  template <class Allocator, class GrowthPolicy>
+  void decode(vector<T, Allocator, GrowthPolicy> &out) const {
+    size_type start = out.size();
+    out.resize_and_overwrite(start + size(), [this, start](T *data,
+                                                           size_type count) {
+      T *next = data + start;
+      for (const Block &block : blocks_) {
+        Decode(block, next);
+        next += block_size;
+      }
+      std::copy(tail_.begin(), tail_.end(), next);
+      return count;
+    });
+  }
+
+  // Index of the first value not less than value, or size(). The values
+  // must be sorted
+  size_type lower_bound(T value) const noexcept {
+    // Blocks whose first value is less than value, the answer is in the
+    // last of them or at the start of the next one
+    auto k = static_cast<size_type>(
+        std::lower_bound(firsts_.begin(), firsts_.end(), value) -
+        firsts_.begin());
+    if (k) {
+      T buffer[block_size];
+      Decode(blocks_[k - 1], buffer);
+      auto pos = static_cast<size_type>(
+          std::lower_bound(buffer, buffer + block_size, value) - buffer);
+      if (pos < block_size) return (k - 1) * block_size + pos;
+    }
+    if (k < blocks_.size()) return k * block_size;
+    return blocks_.size() * block_size +
+           static_cast<size_type>(
+               std::lower_bound(tail_.begin(), tail_.end(), value) -
+               tail_.begin());
+  }
+
+  // Capacity
+  [[nodiscard]] bool empty() const noexcept { return !size(); }
+  size_type size() const noexcept {
+    return blocks_.size() * block_size + tail_.size();
+  }
+  // Blocks decode_block() accepts, the incomplete last one included
+  size_type num_blocks() const noexcept {
+    return blocks_.size() + !tail_.empty();
+  }
+
+  // Heap bytes in use, to compare with size() * sizeof(T)
+  size_type memory_bytes() const noexcept {
+    return words_.size() * sizeof(std::uint64_t) +
+           blocks_.size() * sizeof(Block) + firsts_.size() * sizeof(T) +
+           tail_.size() * sizeof(T);
+  }
+
+  void shrink_to_fit() {
+    words_.shrink_to_fit();
+    blocks_.shrink_to_fit();
+    firsts_.shrink_to_fit();
+  }
+
+  // Modifiers
+  void clear() noexcept {
+    words_.clear();
+    blocks_.clear();
+    firsts_.clear();
+    tail_.clear();
+  }
+
+  void push_back(T value) {
+    if (tail_.capacity() < block_size) tail_.reserve(block_size);
+    tail_.push_back(value);
+    if (tail_.size() == block_size) Seal();
+  }
+
+  template <class InputIt,
+            class = std::enable_if_t<std::is_convertible_v<
+                typename std::iterator_traits<InputIt>::iterator_category,
+                std::input_iterator_tag>>>
+  void append(InputIt first, InputIt last) {
+    for (; first != last; ++first) push_back(*first);
+  }
+
+  void swap(compressed_vector &other) noexcept {
+    words_.swap(other.words_);
+    blocks_.swap(other.blocks_);
+    firsts_.swap(other.firsts_);
+    tail_.swap(other.tail_);
+  }
+};
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_COMPRESSED_VECTOR_H
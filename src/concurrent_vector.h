@@ -0,0 +1,415 @@
+#ifndef CONTAINERS_CPP_CONCURRENT_VECTOR_H
+#define CONTAINERS_CPP_CONCURRENT_VECTOR_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "hardening.h"
+
+namespace s21 {
+
+// Append-only vector many threads can grow and read at once. Elements live
+// in segments of 64, 128, 256, ... elements that are never moved, so
+// references stay valid for the lifetime of the vector. push_back() and
+// grow_by() are lock-free: they reserve indices with one atomic add,
+// allocate a missing segment with a compare-and-swap and publish each
+// element through a bit of its segment's ready bitmap. Reads are wait-free.
+//
+// size() is the length of the published prefix: all of [0, size()) can be
+// read. An element pushed by another thread can be read once size() covers
+// it or is_published() is true. If constructing an element throws, its slot
+// gets T() and the exception propagates; if a segment can't be allocated,
+// the indices reserved in it are lost and size() stops before them.
+template <class T>
+class concurrent_vector {
+  static_assert(std::is_nothrow_destructible_v<T>,
+                "s21::concurrent_vector T must be nothrow destructible");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  class view;
+
+ private:
+  using Word = std::atomic<std::uint64_t>;
+
+  static constexpr size_type kFirstSegment = 64;
+  // Enough for max_size() to fit size_type
+  static constexpr size_type kSegments = 57;
+  static constexpr std::align_val_t kAlignment{
+      std::max<std::size_t>(alignof(T), 64)};
+
+  // A segment is its ready bitmap followed by the elements
+  std::atomic<std::byte *> segments_[kSegments] = {};
+  std::atomic<size_type> reserved_{0};
+  alignas(64) std::atomic<size_type> published_{0};
+
+  static constexpr size_type SegmentOf(size_type index) noexcept {
+    return 63 - __builtin_clzll(index / kFirstSegment + 1);
+  }
+
+  static constexpr size_type SegmentBegin(size_type segment) noexcept {
+    return kFirstSegment * ((size_type{1} << segment) - 1);
+  }
+
+  static constexpr size_type SegmentSize(size_type segment) noexcept {
+    return kFirstSegment << segment;
+  }
+
+  static constexpr size_type ElementsOffset(size_type segment) noexcept {
+    size_type bitmap = SegmentSize(segment) / 64 * sizeof(Word);
+    size_type align = static_cast<size_type>(kAlignment);
+    return (bitmap + align - 1) / align * align;
+  }
+
+  static Word *Ready(std::byte *segment) noexcept {
+    return reinterpret_cast<Word *>(segment);
+  }
+
+  static T *Elements(std::byte *segment, size_type k) noexcept {
+    return reinterpret_cast<T *>(segment + ElementsOffset(k));
+  }
+
+  std::byte *Segment(size_type k) const noexcept {
+    return segments_[k].load(std::memory_order_acquire);
+  }
+
+  // The segment k, allocated by whichever thread gets there first
+  std::byte *EnsureSegment(size_type k) {
+    std::byte *segment = Segment(k);
+    if (segment) return segment;
+    size_type bytes = ElementsOffset(k) + SegmentSize(k) * sizeof(T);
+    auto *fresh = static_cast<std::byte *>(::operator new(bytes, kAlignment));
+    Word *ready = Ready(fresh);
+    for (size_type i = 0; i < SegmentSize(k) / 64; ++i)
+      new (ready + i) Word(0);
+    if (segments_[k].compare_exchange_strong(segment, fresh,
+                                             std::memory_order_acq_rel)) {
+      return fresh;
+    }
+    ::operator delete(fresh, kAlignment);
+    return segment;
+  }
+
+  T *Slot(size_type index) const noexcept {
+    size_type k = SegmentOf(index);
+    return Elements(Segment(k), k) + (index - SegmentBegin(k));
+  }
+
+  void Publish(size_type index) noexcept {
+    size_type k = SegmentOf(index);
+    size_type offset = index - SegmentBegin(k);
+    Ready(Segment(k))[offset / 64].fetch_or(std::uint64_t{1} << offset % 64,
+                                            std::memory_order_seq_cst);
+  }
+
+  // Moves published_ over the run of ready elements it stands at. Every
+  // publishing thread helps, so the prefix never waits for a single one.
+  //
+  // A writer sets its bit, then reads published_ and the other bits: with
+  // acquire and release only, two writers could each read the state before
+  // the other's store and both stop, leaving published_ behind for good.
+  // Sequential consistency of the bit, the loads and the exchange makes at
+  // least one of them see the other's bit.
+  void Advance() noexcept {
+    size_type published = published_.load(std::memory_order_seq_cst);
+    while (true) {
+      size_type k = SegmentOf(published);
+      std::byte *segment = Segment(k);
+      if (!segment) return;
+      size_type offset = published - SegmentBegin(k);
+      std::uint64_t bits =
+          Ready(segment)[offset / 64].load(std::memory_order_seq_cst) >>
+          offset % 64;
+      size_type run = bits == ~std::uint64_t{0} ? 64 : __builtin_ctzll(~bits);
+      run = std::min(run, 64 - offset % 64);
+      if (!run) return;
+      // On failure published is reloaded, go on from wherever it is now
+      if (published_.compare_exchange_weak(published, published + run,
+                                           std::memory_order_seq_cst))
+        published += run;
+    }
+  }
+
+  template <class... Args>
+  void Construct(size_type index, Args &&...args) {
+    T *slot = Slot(index);
+    if constexpr (std::is_nothrow_constructible_v<T, Args...>) {
+      new (slot) T(std::forward<Args>(args)...);
+    } else {
+      static_assert(std::is_nothrow_default_constructible_v<T>,
+                    "s21::concurrent_vector T must be nothrow constructible "
+                    "from the arguments or nothrow default constructible");
+      try {
+        new (slot) T(std::forward<Args>(args)...);
+      } catch (...) {
+        new (slot) T();
+        Publish(index);
+        throw;
+      }
+    }
+    Publish(index);
+  }
+
+  // Constructs [first, first + count) from make(i); if one throws, it and
+  // the rest of the range become T() so the published prefix can go on
+  template <class Make>
+  void ConstructRange(size_type first, size_type count, Make make) {
+    size_type i = first;
+    try {
+      for (; i < first + count; ++i) Construct(i, make(i - first));
+    } catch (...) {
+      if constexpr (std::is_nothrow_default_constructible_v<T>) {
+        for (++i; i < first + count; ++i) {
+          new (Slot(i)) T();
+          Publish(i);
+        }
+      }
+      Advance();
+      throw;
+    }
+    Advance();
+  }
+
+  // Reserves count indices and makes sure their segments exist
+  size_type Reserve(size_type count) {
+    size_type first = reserved_.fetch_add(count, std::memory_order_relaxed);
+    if (first > max_size() || count > max_size() - first)
+      throw std::length_error(
+          "s21::concurrent_vector Size can't grow beyond max_size()");
+    if (count) {
+      for (size_type k = SegmentOf(first); k <= SegmentOf(first + count - 1);
+           ++k)
+        EnsureSegment(k);
+    }
+    return first;
+  }
+
+ public:
+  concurrent_vector() noexcept = default;
+
+  concurrent_vector(const concurrent_vector &) = delete;
+  concurrent_vector &operator=(const concurrent_vector &) = delete;
+
+  // Must not race with any other member function
+  ~concurrent_vector() {
+    size_type size = reserved_.load(std::memory_order_acquire);
+    for (size_type k = 0; k < kSegments; ++k) {
+      std::byte *segment = Segment(k);
+      if (!segment) continue;
+      size_type begin = SegmentBegin(k);
+      size_type end = std::min(size, begin + SegmentSize(k));
+      for (size_type i = begin; i < end; ++i)
+        if (is_published(i)) Elements(segment, k)[i - begin].~T();
+      ::operator delete(segment, kAlignment);
+    }
+  }
+
+  // Appends a new element and returns it, the reference stays valid
+  template <class... Args>
+  reference emplace_back(Args &&...args) {
+    size_type index = Reserve(1);
+    Construct(index, std::forward<Args>(args)...);
+    Advance();
+    return *Slot(index);
+  }
+
+  reference push_back(const_reference value) { return emplace_back(value); }
+
+  reference push_back(value_type &&value) {
+    return emplace_back(std::move(value));
+  }
+
+  // Appends count copies of value as one contiguous range of indices and
+  // returns the first index
+  size_type grow_by(size_type count, const_reference value = value_type()) {
+    size_type first = Reserve(count);
+    ConstructRange(first, count,
+                   [&value](size_type) -> const_reference { return value; });
+    return first;
+  }
+
+  // Appends the elements of [first, last), returns the index of the first
+  template <class ForwardIt,
+            class = std::enable_if_t<std::is_base_of_v<
+                std::forward_iterator_tag,
+                typename std::iterator_traits<ForwardIt>::iterator_category>>>
+  size_type grow_by(ForwardIt first, ForwardIt last) {
+    size_type count = std::distance(first, last);
+    size_type index = Reserve(count);
+    ConstructRange(index, count, [&first](size_type) -> decltype(auto) {
+      return *first++;
+    });
+    return index;
+  }
+
+  // Elements [0, size()) are published and can be read
+  size_type size() const noexcept {
+    return published_.load(std::memory_order_acquire);
+  }
+
+  [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+  static constexpr size_type max_size() noexcept {
+    return SegmentBegin(kSegments);
+  }
+
+  bool is_published(size_type index) const noexcept {
+    if (index >= max_size()) return false;
+    size_type k = SegmentOf(index);
+    std::byte *segment = Segment(k);
+    if (!segment) return false;
+    size_type offset = index - SegmentBegin(k);
+    return Ready(segment)[offset / 64].load(std::memory_order_acquire) >>
+               offset % 64 &
+           1;
+  }
+
+  // Unchecked, index must be published
+  reference operator[](size_type index) noexcept {
+    S21_VECTOR_ASSERT(is_published(index),
+                      "s21::concurrent_vector::operator[] Element isn't "
+                      "published");
+    return *Slot(index);
+  }
+
+  const_reference operator[](size_type index) const noexcept {
+    S21_VECTOR_ASSERT(is_published(index),
+                      "s21::concurrent_vector::operator[] Element isn't "
+                      "published");
+    return *Slot(index);
+  }
+
+  reference at(size_type index) {
+    if (!is_published(index))
+      throw std::out_of_range(
+          "s21::concurrent_vector::at Index isn't a published element");
+    return *Slot(index);
+  }
+
+  const_reference at(size_type index) const {
+    if (!is_published(index))
+      throw std::out_of_range(
+          "s21::concurrent_vector::at Index isn't a published element");
+    return *Slot(index);
+  }
+
+  // View of the elements published now, unaffected by later appends
+  view snapshot() const noexcept { return view(*this); }
+};
+
+// The published prefix of a concurrent_vector at one point in time, with
+// random access iterators. Valid as long as the vector is
+template <class T>
+class concurrent_vector<T>::view {
+ public:
+  class iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T *;
+    using reference = const T &;
+
+    iterator() noexcept = default;
+
+    reference operator*() const noexcept { return (*vector_)[index_]; }
+    pointer operator->() const noexcept { return &**this; }
+    reference operator[](difference_type n) const noexcept {
+      return *(*this + n);
+    }
+
+    iterator &operator++() noexcept {
+      ++index_;
+      return *this;
+    }
+    iterator operator++(int) noexcept { return iterator(vector_, index_++); }
+    iterator &operator--() noexcept {
+      --index_;
+      return *this;
+    }
+    iterator operator--(int) noexcept { return iterator(vector_, index_--); }
+    iterator &operator+=(difference_type n) noexcept {
+      index_ += n;
+      return *this;
+    }
+    iterator &operator-=(difference_type n) noexcept {
+      index_ -= n;
+      return *this;
+    }
+    friend iterator operator+(iterator it, difference_type n) noexcept {
+      return it += n;
+    }
+    friend iterator operator+(difference_type n, iterator it) noexcept {
+      return it += n;
+    }
+    friend iterator operator-(iterator it, difference_type n) noexcept {
+      return it -= n;
+    }
+    friend difference_type operator-(iterator a, iterator b) noexcept {
+      return static_cast<difference_type>(a.index_ - b.index_);
+    }
+    friend bool operator==(iterator a, iterator b) noexcept {
+      return a.index_ == b.index_;
+    }
+    friend bool operator!=(iterator a, iterator b) noexcept {
+      return a.index_ != b.index_;
+    }
+    friend bool operator<(iterator a, iterator b) noexcept {
+      return a.index_ < b.index_;
+    }
+    friend bool operator>(iterator a, iterator b) noexcept { return b < a; }
+    friend bool operator<=(iterator a, iterator b) noexcept {
+      return !(b < a);
+    }
+    friend bool operator>=(iterator a, iterator b) noexcept {
+      return !(a < b);
+    }
+
+   private:
+    friend class view;
+
+    iterator(const concurrent_vector *vector, size_type index) noexcept
+        : vector_(vector), index_(index) {}
+
+    const concurrent_vector *vector_ = nullptr;
+    size_type index_ = 0;
+  };
+
+  using const_iterator = iterator;
+
+  explicit view(const concurrent_vector &vector) noexcept
+      : vector_(&vector), size_(vector.size()) {}
+
+  size_type size() const noexcept { return size_; }
+
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+  const_reference operator[](size_type index) const noexcept {
+    S21_VECTOR_ASSERT(index < size_,
+                      "s21::concurrent_vector::view::operator[] Index "
+                      "out of range");
+    return (*vector_)[index];
+  }
+
+  iterator begin() const noexcept { return iterator(vector_, 0); }
+  iterator end() const noexcept { return iterator(vector_, size_); }
+
+ private:
+  const concurrent_vector *vector_;
+  size_type size_;
+};
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_CONCURRENT_VECTOR_H
@@ -0,0 +1,611 @@
+#ifndef CONTAINERS_CPP_FLAT_MAP_H
+#define CONTAINERS_CPP_FLAT_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "flat_set.h"
+#include "hardening.h"
+#include "vector.h"
+
+namespace s21 {
+
+// Ordered map of unique keys kept as two parallel s21::vectors, the sorted
+// keys and the values at the same positions. A lookup binary searches the
+// keys alone, so every cache line it touches is full of keys; the values
+// are read only on a hit. Iterators dereference to pair<const Key &, T &>
+// proxies and are invalidated by every insertion and erasure.
+template <class Key, class T, class Compare = std::less<Key>,
+          class KeyAllocator = std::allocator<Key>,
+          class MappedAllocator = std::allocator<T>>
+class flat_map {
+ public:
+  // Member types
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<Key, T>;
+  using key_compare = Compare;
+  using reference = std::pair<const Key &, T &>;
+  using const_reference = std::pair<const Key &, const T &>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using key_container_type = vector<Key, KeyAllocator>;
+  using mapped_container_type = vector<T, MappedAllocator>;
+
+ private:
+  template <class It>
+  using RequireInputIterator = std::enable_if_t<std::is_convertible_v<
+      typename std::iterator_traits<It>::iterator_category,
+      std::input_iterator_tag>>;
+
+  template <bool Const>
+  class Iter {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = flat_map::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::conditional_t<Const, flat_map::const_reference,
+                                         flat_map::reference>;
+
+    // it->first and it->second on a proxy that lives in the arrow
+    struct pointer {
+      reference ref;
+      const reference *operator->() const noexcept { return &ref; }
+    };
+
+    Iter() noexcept = default;
+
+    // iterator converts to const_iterator
+    template <bool Other, class = std::enable_if_t<Const && !Other>>
+    Iter(const Iter<Other> &other) noexcept
+        : map_(other.map_), pos_(other.pos_) {}
+
+    reference operator*() const noexcept {
+      return reference(map_->keys_[pos_], map_->values_[pos_]);
+    }
+    pointer operator->() const noexcept { return pointer{**this}; }
+    reference operator[](difference_type n) const noexcept {
+      return *(*this + n);
+    }
+
+    Iter &operator++() noexcept {
+      ++pos_;
+      return *this;
+    }
+    Iter operator++(int) noexcept { return Iter(map_, pos_++); }
+    Iter &operator--() noexcept {
+      --pos_;
+      return *this;
+    }
+    Iter operator--(int) noexcept { return Iter(map_, pos_--); }
+    Iter &operator+=(difference_type n) noexcept {
+      pos_ += n;
+      return *this;
+    }
+    Iter &operator-=(difference_type n) noexcept {
+      pos_ -= n;
+      return *this;
+    }
+
+    friend Iter operator+(Iter it, difference_type n) noexcept {
+      return it += n;
+    }
+    friend Iter operator+(difference_type n, Iter it) noexcept {
+      return it += n;
+    }
+    friend Iter operator-(Iter it, difference_type n) noexcept {
+      return it -= n;
+    }
+    friend difference_type operator-(const Iter &a, const Iter &b) noexcept {
+      return static_cast<difference_type>(a.pos_) -
+             static_cast<difference_type>(b.pos_);
+    }
+    friend bool operator==(const Iter &a, const Iter &b) noexcept {
+      return a.pos_ == b.pos_;
+    }
+    friend bool operator!=(const Iter &a, const Iter &b) noexcept {
+      return a.pos_ != b.pos_;
+    }
+    friend bool operator<(const Iter &a, const Iter &b) noexcept {
+      return a.pos_ < b.pos_;
+    }
+    friend bool operator>(const Iter &a, const Iter &b) noexcept {
+      return a.pos_ > b.pos_;
+    }
+    friend bool operator<=(const Iter &a, const Iter &b) noexcept {
+      return a.pos_ <= b.pos_;
+    }
+    friend bool operator>=(const Iter &a, const Iter &b) noexcept {
+      return a.pos_ >= b.pos_;
+    }
+
+   private:
+    friend class flat_map;
+    template <bool>
+    friend class Iter;
+
+    using Map = std::conditional_t<Const, const flat_map, flat_map>;
+
+    Iter(Map *map, size_type pos) noexcept : map_(map), pos_(pos) {}
+
+    Map *map_ = nullptr;
+    size_type pos_ = 0;
+  };
+
+ public:
+  using iterator = Iter<false>;
+  using const_iterator = Iter<true>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+ private:
+  template <class K>
+  using RequireTransparent =
+      std::enable_if_t<detail::kIsTransparent<Compare> &&
+                       !std::is_convertible_v<K, const_iterator>>;
+
+  key_container_type keys_;
+  mapped_container_type values_;
+  Compare comp_;
+
+  template <class K>
+  size_type LowerBound(const K &key) const {
+    return static_cast<size_type>(
+        detail::BranchlessLowerBound(keys_.data(), keys_.size(), key, comp_) -
+        keys_.data());
+  }
+
+  template <class K>
+  size_type UpperBound(const K &key) const {
+    return static_cast<size_type>(
+        detail::BranchlessUpperBound(keys_.data(), keys_.size(), key, comp_) -
+        keys_.data());
+  }
+
+  template <class K>
+  size_type Find(const K &key) const {
+    size_type pos = LowerBound(key);
+    return pos != keys_.size() && !comp_(key, keys_[pos]) ? pos
+                                                          : keys_.size();
+  }
+
+  // Inserts at pos, which LowerBound() found for key. A throwing value
+  // takes its key back out
+  template <class K, class... Args>
+  void InsertAt(size_type pos, K &&key, Args &&...args) {
+    keys_.insert(keys_.begin() + pos, std::forward<K>(key));
+    try {
+      values_.insert(values_.begin() + pos, T(std::forward<Args>(args)...));
+    } catch (...) {
+      keys_.erase(keys_.begin() + pos);
+      throw;
+    }
+  }
+
+  template <class K, class... Args>
+  std::pair<iterator, bool> TryEmplace(K &&key, Args &&...args) {
+    size_type pos = LowerBound(key);
+    if (pos != keys_.size() && !comp_(key, keys_[pos]))
+      return {iterator(this, pos), false};
+    InsertAt(pos, std::forward<K>(key), std::forward<Args>(args)...);
+    return {iterator(this, pos), true};
+  }
+
+  // The merge copies pairs out of keys_ and values_ so the originals
+  // survive a throw. It moves them when neither move can throw, and when
+  // the pairs can't be copied, whatever their moves do
+  static constexpr bool kMoveOut =
+      (std::is_nothrow_move_constructible_v<Key> &&
+       std::is_nothrow_move_constructible_v<T>) ||
+      !std::is_copy_constructible_v<Key> || !std::is_copy_constructible_v<T>;
+
+  template <class U>
+  static decltype(auto) Out(U &value) noexcept {
+    if constexpr (kMoveOut) {
+      return std::move(value);
+    } else {
+      return std::as_const(value);
+    }
+  }
+
+  // Sorts the pairs appended from old_size on by key and merges them with
+  // the previous ones into new vectors: O(n + k log k) for k new pairs
+  // instead of k shifting inserts. Of equivalent keys the pair that was
+  // there first stays. The merge order is worked out with comparisons
+  // only, before any pair is moved. On exception the appended pairs are
+  // dropped, the map is as before the insertion. Only if a move of pairs
+  // that can't be copied throws, the pairs moved from are lost and the map
+  // is cleared: the basic guarantee
+  void MergeTail(size_type old_size) {
+    size_type size = keys_.size();
+    if (old_size == size) return;
+    bool moving = false;
+    try {
+      vector<size_type> order(size - old_size);
+      for (size_type i = 0; i < order.size(); ++i) order[i] = old_size + i;
+      std::stable_sort(order.begin(), order.end(),
+                       [this](size_type a, size_type b) {
+                         return comp_(keys_[a], keys_[b]);
+                       });
+      if (kMoveOut &&
+          (!old_size || !comp_(keys_[order.front()], keys_[old_size - 1]))) {
+        // The new run starts past the old keys, only it is reordered
+        AppendInOrder(old_size, order);
+        return;
+      }
+      vector<size_type> merged;
+      merged.reserve(size);
+      auto take = [&](size_type i) {
+        if (merged.empty() || comp_(keys_[merged.back()], keys_[i]))
+          merged.push_back(i);
+      };
+      size_type i = 0;
+      for (size_type j : order) {
+        while (i < old_size && !comp_(keys_[j], keys_[i])) take(i++);
+        take(j);
+      }
+      while (i < old_size) take(i++);
+      key_container_type keys;
+      mapped_container_type values;
+      keys.reserve(merged.size());
+      values.reserve(merged.size());
+      moving = kMoveOut;
+      for (size_type m : merged) {
+        keys.push_back(Out(keys_[m]));
+        values.push_back(Out(values_[m]));
+      }
+      keys_.swap(keys);
+      values_.swap(values);
+    } catch (...) {
+      if (moving) {
+        keys_.clear();
+        values_.clear();
+      } else {
+        keys_.erase(keys_.begin() + old_size, keys_.end());
+        values_.erase(values_.begin() + old_size, values_.end());
+      }
+      throw;
+    }
+  }
+
+  // Moves the pairs at order to the end of [0, old_size) without
+  // duplicates. Only called with kMoveOut. The old pairs stay in place,
+  // after a throwing move dropping the appended ones restores the map
+  void AppendInOrder(size_type old_size, const vector<size_type> &order) {
+    vector<size_type> kept;
+    kept.reserve(order.size());
+    for (size_type j : order) {
+      if (kept.empty() ? !old_size || comp_(keys_[old_size - 1], keys_[j])
+                       : comp_(keys_[kept.back()], keys_[j]))
+        kept.push_back(j);
+    }
+    key_container_type keys;
+    mapped_container_type values;
+    keys.reserve(kept.size());
+    values.reserve(kept.size());
+    for (size_type j : kept) {
+      keys.push_back(std::move(keys_[j]));
+      values.push_back(std::move(values_[j]));
+    }
+    keys_.erase(keys_.begin() + old_size, keys_.end());
+    values_.erase(values_.begin() + old_size, values_.end());
+    keys_.insert(keys_.end(), std::make_move_iterator(keys.begin()),
+                 std::make_move_iterator(keys.end()));
+    values_.insert(values_.end(), std::make_move_iterator(values.begin()),
+                   std::make_move_iterator(values.end()));
+  }
+
+ public:
+  // Constructors
+  flat_map() = default;
+
+  explicit flat_map(const Compare &comp) : comp_(comp) {}
+
+  template <class InputIt, class = RequireInputIterator<InputIt>>
+  flat_map(InputIt first, InputIt last, const Compare &comp = Compare())
+      : comp_(comp) {
+    insert(first, last);
+  }
+
+  flat_map(std::initializer_list<value_type> init,
+           const Compare &comp = Compare())
+      : flat_map(init.begin(), init.end(), comp) {}
+
+  // Adopts keys and the values at the same positions. The keys must be
+  // sorted by comp and free of duplicates
+  flat_map(sorted_unique_t, key_container_type keys,
+           mapped_container_type values, const Compare &comp = Compare())
+      : keys_(std::move(keys)), values_(std::move(values)), comp_(comp) {
+    if (keys_.size() != values_.size())
+      throw std::invalid_argument(
+          "s21::flat_map::flat_map Keys and values differ in size");
+    S21_VECTOR_ASSERT(
+        detail::IsSortedUnique(keys_.begin(), keys_.end(), comp_),
+        "s21::flat_map::flat_map The keys aren't sorted and unique");
+  }
+
+  flat_map &operator=(std::initializer_list<value_type> init) {
+    clear();
+    insert(init);
+    return *this;
+  }
+
+  // Iterators
+  iterator begin() noexcept { return iterator(this, 0); }
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  iterator end() noexcept { return iterator(this, size()); }
+  const_iterator end() const noexcept { return const_iterator(this, size()); }
+  const_iterator cend() const noexcept { return end(); }
+  reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin() const noexcept {
+    return const_reverse_iterator(end());
+  }
+  reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+  const_reverse_iterator rend() const noexcept {
+    return const_reverse_iterator(begin());
+  }
+
+  // Element access
+  T &at(const key_type &key) {
+    size_type pos = Find(key);
+    if (pos == size())
+      throw std::out_of_range("s21::flat_map::at The key is not found");
+    return values_[pos];
+  }
+
+  const T &at(const key_type &key) const {
+    size_type pos = Find(key);
+    if (pos == size())
+      throw std::out_of_range("s21::flat_map::at The key is not found");
+    return values_[pos];
+  }
+
+  template <class K, class = RequireTransparent<K>>
+  T &at(const K &key) {
+    size_type pos = Find(key);
+    if (pos == size())
+      throw std::out_of_range("s21::flat_map::at The key is not found");
+    return values_[pos];
+  }
+
+  template <class K, class = RequireTransparent<K>>
+  const T &at(const K &key) const {
+    size_type pos = Find(key);
+    if (pos == size())
+      throw std::out_of_range("s21::flat_map::at The key is not found");
+    return values_[pos];
+  }
+
+  T &operator[](const key_type &key) {
+    return values_[TryEmplace(key).first.pos_];
+  }
+
+  T &operator[](key_type &&key) {
+    return values_[TryEmplace(std::move(key)).first.pos_];
+  }
+
+  // Capacity
+  [[nodiscard]] bool empty() const noexcept { return keys_.empty(); }
+  size_type size() const noexcept { return keys_.size(); }
+  size_type max_size() const noexcept {
+    return std::min(keys_.max_size(), values_.max_size());
+  }
+  void reserve(size_type new_capacity) {
+    keys_.reserve(new_capacity);
+    values_.reserve(new_capacity);
+  }
+  void shrink_to_fit() {
+    keys_.shrink_to_fit();
+    values_.shrink_to_fit();
+  }
+
+  // Modifiers
+  void clear() noexcept {
+    keys_.clear();
+    values_.clear();
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return TryEmplace(value.first, value.second);
+  }
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return TryEmplace(std::move(value.first), std::move(value.second));
+  }
+
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    value_type value(std::forward<Args>(args)...);
+    return insert(std::move(value));
+  }
+
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args) {
+    return TryEmplace(key, std::forward<Args>(args)...);
+  }
+
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(key_type &&key, Args &&...args) {
+    return TryEmplace(std::move(key), std::forward<Args>(args)...);
+  }
+
+  template <class M>
+  std::pair<iterator, bool> insert_or_assign(const key_type &key, M &&obj) {
+    auto result = TryEmplace(key, std::forward<M>(obj));
+    if (!result.second) values_[result.first.pos_] = std::forward<M>(obj);
+    return result;
+  }
+
+  template <class M>
+  std::pair<iterator, bool> insert_or_assign(key_type &&key, M &&obj) {
+    auto result = TryEmplace(std::move(key), std::forward<M>(obj));
+    if (!result.second) values_[result.first.pos_] = std::forward<M>(obj);
+    return result;
+  }
+
+  // Appends the pairs, then sorts and merges them in one pass, see
+  // MergeTail()
+  template <class InputIt, class = RequireInputIterator<InputIt>>
+  void insert(InputIt first, InputIt last) {
+    size_type old_size = size();
+    try {
+      for (; first != last; ++first) {
+        const auto &[key, value] = *first;
+        keys_.push_back(key);
+        try {
+          values_.push_back(value);
+        } catch (...) {
+          keys_.pop_back();
+          throw;
+        }
+      }
+    } catch (...) {
+      keys_.erase(keys_.begin() + old_size, keys_.end());
+      values_.erase(values_.begin() + old_size, values_.end());
+      throw;
+    }
+    MergeTail(old_size);
+  }
+
+  void insert(std::initializer_list<value_type> init) {
+    insert(init.begin(), init.end());
+  }
+
+  iterator erase(const_iterator pos) {
+    keys_.erase(keys_.begin() + pos.pos_);
+    values_.erase(values_.begin() + pos.pos_);
+    return iterator(this, pos.pos_);
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    keys_.erase(keys_.begin() + first.pos_, keys_.begin() + last.pos_);
+    values_.erase(values_.begin() + first.pos_, values_.begin() + last.pos_);
+    return iterator(this, first.pos_);
+  }
+
+  size_type erase(const key_type &key) {
+    size_type pos = Find(key);
+    if (pos == size()) return 0;
+    erase(const_iterator(this, pos));
+    return 1;
+  }
+
+  template <class K, class = RequireTransparent<K>>
+  size_type erase(const K &key) {
+    size_type first = LowerBound(key);
+    size_type last = UpperBound(key);
+    erase(const_iterator(this, first), const_iterator(this, last));
+    return last - first;
+  }
+
+  void swap(flat_map &other) noexcept {
+    keys_.swap(other.keys_);
+    values_.swap(other.values_);
+    std::swap(comp_, other.comp_);
+  }
+
+  // Lookup
+  iterator find(const key_type &key) { return iterator(this, Find(key)); }
+
+  const_iterator find(const key_type &key) const {
+    return const_iterator(this, Find(key));
+  }
+
+  template <class K, class = RequireTransparent<K>>
+  iterator find(const K &key) {
+    return iterator(this, Find(key));
+  }
+
+  template <class K, class = RequireTransparent<K>>
+  const_iterator find(const K &key) const {
+    return const_iterator(this, Find(key));
+  }
+
+  size_type count(const key_type &key) const { return Find(key) != size(); }
+
+  template <class K, class = RequireTransparent<K>>
+  size_type count(const K &key) const {
+    return UpperBound(key) - LowerBound(key);
+  }
+
+  bool contains(const key_type &key) const { return Find(key) != size(); }
+
+  template <class K, class = RequireTransparent<K>>
+  bool contains(const K &key) const {
+    return Find(key) != size();
+  }
+
+  iterator lower_bound(const key_type &key) {
+    return iterator(this, LowerBound(key));
+  }
+
+  const_iterator lower_bound(const key_type &key) const {
+    return const_iterator(this, LowerBound(key));
+  }
+
+  template <class K, class = RequireTransparent<K>>
+  iterator lower_bound(const K &key) {
+    return iterator(this, LowerBound(key));
+  }
+
+  template <class K, class = RequireTransparent<K>>
+  const_iterator lower_bound(const K &key) const {
+    return const_iterator(this, LowerBound(key));
+  }
+
+  iterator upper_bound(const key_type &key) {
+    return iterator(this, UpperBound(key));
+  }
+
+  const_iterator upper_bound(const key_type &key) const {
+    return const_iterator(this, UpperBound(key));
+  }
+
+  template <class K, class = RequireTransparent<K>>
+  iterator upper_bound(const K &key) {
+    return iterator(this, UpperBound(key));
+  }
+
+  template <class K, class = RequireTransparent<K>>
+  const_iterator upper_bound(const K &key) const {
+    return const_iterator(this, UpperBound(key));
+  }
+
+  std::pair<iterator, iterator> equal_range(const key_type &key) {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  std::pair<const_iterator, const_iterator> equal_range(
+      const key_type &key) const {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  template <class K, class = RequireTransparent<K>>
+  std::pair<iterator, iterator> equal_range(const K &key) {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  template <class K, class = RequireTransparent<K>>
+  std::pair<const_iterator, const_iterator> equal_range(const K &key) const {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  // Observers
+  key_compare key_comp() const { return comp_; }
+
+  // The sorted keys and the values in the same order
+  const key_container_type &keys() const noexcept { return keys_; }
+  const mapped_container_type &values() const noexcept { return values_; }
+};
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_FLAT_MAP_H
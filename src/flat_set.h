@@ -0,0 +1,353 @@
+#ifndef CONTAINERS_CPP_FLAT_SET_H
+#define CONTAINERS_CPP_FLAT_SET_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "hardening.h"
+#include "vector.h"
+
+namespace s21 {
+
+// Tag for constructors that adopt data already sorted and free of
+// duplicates, checked only in hardened builds
+struct sorted_unique_t {
+  explicit sorted_unique_t() = default;
+};
+inline constexpr sorted_unique_t sorted_unique{};
+
+namespace detail {
+
+template <class Compare, class = void>
+inline constexpr bool kIsTransparent = false;
+
+template <class Compare>
+inline constexpr bool kIsTransparent<
+    Compare, std::void_t<typename Compare::is_transparent>> = true;
+
+// Binary search whose comparison only selects the next base, which
+// compiles to a conditional move instead of a branch: the loop runs
+// log2(size) times for every key and never mispredicts. The first element
+// of [first, first + size) for which less(element, key) is false
+template <class T, class K, class Less>
+const T *BranchlessLowerBound(const T *first, std::size_t size, const K &key,
+                              Less &less) {
+  if (!size) return first;
+  while (size > 1) {
+    std::size_t half = size / 2;
+    first = less(first[half], key) ? first + half : first;
+    size -= half;
+  }
+  return first + less(*first, key);
+}
+
+// The first element greater than key
+template <class T, class K, class Less>
+const T *BranchlessUpperBound(const T *first, std::size_t size, const K &key,
+                              Less &less) {
+  if (!size) return first;
+  while (size > 1) {
+    std::size_t half = size / 2;
+    first = !less(key, first[half]) ? first + half : first;
+    size -= half;
+  }
+  return first + !less(key, *first);
+}
+
+template <class T, class Less>
+bool IsSortedUnique(const T *first, const T *last, Less &less) {
+  return std::adjacent_find(first, last, [&less](const T &a, const T &b) {
+           return !less(a, b);
+         }) == last;
+}
+
+}  // namespace detail
+
+// Ordered set of unique keys kept in one sorted s21::vector: lookups are
+// binary searches over contiguous memory, which beats a node based
+// std::set for read-mostly tables. Single inserts and erases shift the
+// tail, build large sets with the range insert or sorted_unique instead.
+// Iterators are invalidated by every modification.
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = std::allocator<Key>>
+class flat_set {
+ public:
+  // Member types
+  using key_type = Key;
+  using value_type = Key;
+  using key_compare = Compare;
+  using value_compare = Compare;
+  using container_type = vector<Key, Allocator>;
+  using reference = const Key &;
+  using const_reference = const Key &;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using iterator = const Key *;
+  using const_iterator = const Key *;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+ private:
+  template <class K>
+  using RequireTransparent =
+      std::enable_if_t<detail::kIsTransparent<Compare> &&
+                       !std::is_convertible_v<K, iterator>>;
+
+  template <class It>
+  using RequireInputIterator = std::enable_if_t<std::is_convertible_v<
+      typename std::iterator_traits<It>::iterator_category,
+      std::input_iterator_tag>>;
+
+  container_type keys_;
+  Compare comp_;
+
+  template <class K>
+  const Key *LowerBound(const K &key) const {
+    return detail::BranchlessLowerBound(keys_.data(), keys_.size(), key,
+                                        comp_);
+  }
+
+  template <class K>
+  const Key *UpperBound(const K &key) const {
+    return detail::BranchlessUpperBound(keys_.data(), keys_.size(), key,
+                                        comp_);
+  }
+
+  template <class K>
+  const Key *Find(const K &key) const {
+    const Key *it = LowerBound(key);
+    return it != end() && !comp_(key, *it) ? it : end();
+  }
+
+  template <class K>
+  std::pair<iterator, bool> InsertUnique(K &&key) {
+    const Key *it = LowerBound(key);
+    if (it != end() && !comp_(key, *it)) return {it, false};
+    auto pos = keys_.insert(it, std::forward<K>(key));
+    return {pos, true};
+  }
+
+  // Sorts the keys appended from old_size on, merges them with the
+  // previous ones and drops the duplicates: O(n + k log k) for k new keys
+  // instead of k shifting inserts. Of equivalent keys the one that was
+  // there first stays
+  void MergeTail(size_type old_size) {
+    Key *first = keys_.begin();
+    Key *middle = first + old_size;
+    Key *last = keys_.end();
+    if (middle == last) return;
+    auto less = [this](const Key &a, const Key &b) { return comp_(a, b); };
+    std::stable_sort(middle, last, less);
+    if (first != middle && comp_(*middle, middle[-1]))
+      std::inplace_merge(first, middle, last, less);
+    else if (first != middle && !comp_(middle[-1], *middle))
+      first = middle - 1;  // Only the boundary and the new run can repeat
+    else
+      first = middle;
+    keys_.erase(std::unique(first, last,
+                            [this](const Key &a, const Key &b) {
+                              return !comp_(a, b);
+                            }),
+                last);
+  }
+
+ public:
+  // Constructors
+  flat_set() = default;
+
+  explicit flat_set(const Compare &comp) : comp_(comp) {}
+
+  template <class InputIt, class = RequireInputIterator<InputIt>>
+  flat_set(InputIt first, InputIt last, const Compare &comp = Compare())
+      : comp_(comp) {
+    insert(first, last);
+  }
+
+  flat_set(std::initializer_list<value_type> init,
+           const Compare &comp = Compare())
+      : flat_set(init.begin(), init.end(), comp) {}
+
+  // Adopts keys, which must be sorted by comp and free of duplicates
+  flat_set(sorted_unique_t, container_type keys,
+           const Compare &comp = Compare())
+      : keys_(std::move(keys)), comp_(comp) {
+    S21_VECTOR_ASSERT(
+        detail::IsSortedUnique(keys_.begin(), keys_.end(), comp_),
+        "s21::flat_set::flat_set The keys aren't sorted and unique");
+  }
+
+  template <class InputIt, class = RequireInputIterator<InputIt>>
+  flat_set(sorted_unique_t, InputIt first, InputIt last,
+           const Compare &comp = Compare())
+      : flat_set(sorted_unique, container_type(first, last), comp) {}
+
+  flat_set(sorted_unique_t, std::initializer_list<value_type> init,
+           const Compare &comp = Compare())
+      : flat_set(sorted_unique, container_type(init), comp) {}
+
+  flat_set &operator=(std::initializer_list<value_type> init) {
+    clear();
+    insert(init);
+    return *this;
+  }
+
+  // Iterators
+  const_iterator begin() const noexcept { return keys_.begin(); }
+  const_iterator cbegin() const noexcept { return keys_.begin(); }
+  const_iterator end() const noexcept { return keys_.end(); }
+  const_iterator cend() const noexcept { return keys_.end(); }
+  const_reverse_iterator rbegin() const noexcept {
+    return const_reverse_iterator(end());
+  }
+  const_reverse_iterator rend() const noexcept {
+    return const_reverse_iterator(begin());
+  }
+
+  // Capacity
+  [[nodiscard]] bool empty() const noexcept { return keys_.empty(); }
+  size_type size() const noexcept { return keys_.size(); }
+  size_type max_size() const noexcept { return keys_.max_size(); }
+  size_type capacity() const noexcept { return keys_.capacity(); }
+  void reserve(size_type new_capacity) { keys_.reserve(new_capacity); }
+  void shrink_to_fit() { keys_.shrink_to_fit(); }
+
+  // Modifiers
+  void clear() noexcept { keys_.clear(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return InsertUnique(value);
+  }
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return InsertUnique(std::move(value));
+  }
+
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return InsertUnique(Key(std::forward<Args>(args)...));
+  }
+
+  // Appends the range, then sorts and merges it in one pass, see MergeTail()
+  template <class InputIt, class = RequireInputIterator<InputIt>>
+  void insert(InputIt first, InputIt last) {
+    size_type old_size = keys_.size();
+    keys_.insert(keys_.end(), first, last);
+    MergeTail(old_size);
+  }
+
+  void insert(std::initializer_list<value_type> init) {
+    insert(init.begin(), init.end());
+  }
+
+  // Like insert(first, last) for a range known to be sorted and unique:
+  // skips sorting the new run
+  template <class InputIt, class = RequireInputIterator<InputIt>>
+  void insert(sorted_unique_t, InputIt first, InputIt last) {
+    size_type old_size = keys_.size();
+    keys_.insert(keys_.end(), first, last);
+    S21_VECTOR_ASSERT(
+        detail::IsSortedUnique(keys_.begin() + old_size, keys_.end(), comp_),
+        "s21::flat_set::insert The keys aren't sorted and unique");
+    MergeTail(old_size);
+  }
+
+  iterator erase(const_iterator pos) { return keys_.erase(pos, pos + 1); }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    return keys_.erase(first, last);
+  }
+
+  size_type erase(const key_type &key) {
+    const Key *it = Find(key);
+    if (it == end()) return 0;
+    keys_.erase(it, it + 1);
+    return 1;
+  }
+
+  template <class K, class = RequireTransparent<K>>
+  size_type erase(const K &key) {
+    auto [first, last] = equal_range(key);
+    keys_.erase(first, last);
+    return static_cast<size_type>(last - first);
+  }
+
+  void swap(flat_set &other) noexcept {
+    keys_.swap(other.keys_);
+    std::swap(comp_, other.comp_);
+  }
+
+  // Hands out the sorted keys and leaves the set empty
+  container_type extract() && {
+    container_type keys = std::move(keys_);
+    keys_.clear();
+    return keys;
+  }
+
+  // Lookup
+  const_iterator find(const key_type &key) const { return Find(key); }
+
+  template <class K, class = RequireTransparent<K>>
+  const_iterator find(const K &key) const {
+    return Find(key);
+  }
+
+  size_type count(const key_type &key) const { return Find(key) != end(); }
+
+  template <class K, class = RequireTransparent<K>>
+  size_type count(const K &key) const {
+    auto [first, last] = equal_range(key);
+    return static_cast<size_type>(last - first);
+  }
+
+  bool contains(const key_type &key) const { return Find(key) != end(); }
+
+  template <class K, class = RequireTransparent<K>>
+  bool contains(const K &key) const {
+    return Find(key) != end();
+  }
+
+  const_iterator lower_bound(const key_type &key) const {
+    return LowerBound(key);
+  }
+
+  template <class K, class = RequireTransparent<K>>
+  const_iterator lower_bound(const K &key) const {
+    return LowerBound(key);
+  }
+
+  const_iterator upper_bound(const key_type &key) const {
+    return UpperBound(key);
+  }
+
+  template <class K, class = RequireTransparent<K>>
+  const_iterator upper_bound(const K &key) const {
+    return UpperBound(key);
+  }
+
+  std::pair<const_iterator, const_iterator> equal_range(
+      const key_type &key) const {
+    return {LowerBound(key), UpperBound(key)};
+  }
+
+  template <class K, class = RequireTransparent<K>>
+  std::pair<const_iterator, const_iterator> equal_range(const K &key) const {
+    return {LowerBound(key), UpperBound(key)};
+  }
+
+  // Observers
+  key_compare key_comp() const { return comp_; }
+  value_compare value_comp() const { return comp_; }
+
+  // The sorted keys
+  const container_type &sequence() const noexcept { return keys_; }
+};
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_FLAT_SET_H
@@ -0,0 +1,122 @@
+#ifndef CONTAINERS_CPP_GROWTH_POLICY_H
+#define CONTAINERS_CPP_GROWTH_POLICY_H
+
+#include <algorithm>
+#include <cstddef>
+
+namespace s21 {
+
+// Growth policies decide the capacity s21::vector moves to once an
+// insertion doesn't fit. A policy is a type with
+//
+//   static std::size_t next_capacity(std::size_t size, std::size_t required,
+//                                    std::size_t element_size) noexcept;
+//
+// returning a capacity of at least required elements. The vector clamps the
+// result to max_size().
+namespace growth {
+
+// Doubles the size, the classic amortized O(1) choice
+struct doubling {
+  static constexpr std::size_t next_capacity(std::size_t size,
+                                             std::size_t required,
+                                             std::size_t) noexcept {
+    return std::max(size * 2, required);
+  }
+};
+
+// Grows by half the size. Wastes at most a third of the block, and the
+// blocks freed by earlier steps eventually add up to the next request, so
+// the allocator can reuse them
+struct one_and_a_half {
+  static constexpr std::size_t next_capacity(std::size_t size,
+                                             std::size_t required,
+                                             std::size_t) noexcept {
+    return std::max(size + size / 2, required);
+  }
+};
+
+// Grows by half and rounds the block up to the allocator's size classes:
+// 16 byte steps up to 128 bytes, then four classes per power of two, the
+// layout of jemalloc bins and close to glibc malloc chunk sizes. Memory the
+// allocator would hand out anyway becomes usable capacity.
+struct size_class {
+  static constexpr std::size_t round_bytes(std::size_t bytes) noexcept {
+    if (bytes <= 128) return (bytes + 15) & ~std::size_t{15};
+    std::size_t power = 128;
+    while (power * 2 < bytes) power *= 2;
+    std::size_t step = power / 4;
+    return (bytes + step - 1) / step * step;
+  }
+
+  static constexpr std::size_t next_capacity(
+      std::size_t size, std::size_t required,
+      std::size_t element_size) noexcept {
+    std::size_t wanted =
+        one_and_a_half::next_capacity(size, required, element_size);
+    return std::max(round_bytes(wanted * element_size) / element_size,
+                    wanted);
+  }
+};
+
+// Geometric growth for small buffers, and for blocks of a page or more the
+// byte size is rounded to whole pages, which is what the kernel maps anyway
+template <std::size_t PageSize = 4096>
+struct page_granular {
+  static_assert((PageSize & (PageSize - 1)) == 0,
+                "s21::growth::page_granular PageSize must be a power of two");
+
+  static constexpr std::size_t next_capacity(
+      std::size_t size, std::size_t required,
+      std::size_t element_size) noexcept {
+    std::size_t wanted =
+        one_and_a_half::next_capacity(size, required, element_size);
+    std::size_t bytes = wanted * element_size;
+    if (bytes < PageSize) return doubling::next_capacity(size, required, 0);
+    bytes = (bytes + PageSize - 1) & ~(PageSize - 1);
+    return std::max(bytes / element_size, wanted);
+  }
+};
+
+// Doubles and rounds the block up to a power of two bytes, at least 16:
+// the size classes of recycling_allocator, so the capacity covers the
+// whole recycled block
+struct power_of_two {
+  static constexpr std::size_t next_capacity(
+      std::size_t size, std::size_t required,
+      std::size_t element_size) noexcept {
+    std::size_t wanted = doubling::next_capacity(size, required, 0);
+    if (!element_size || wanted > static_cast<std::size_t>(-1) / 2 /
+                                      element_size)
+      return wanted;
+    std::size_t bytes = 16;
+    while (bytes < wanted * element_size) bytes *= 2;
+    return std::max(bytes / element_size, wanted);
+  }
+};
+
+// Base growth, then the capacity rounded up so the block fills whole
+// LineSize byte lines: the padding aligned_allocator adds anyway becomes
+// usable capacity
+template <class Base = doubling, std::size_t LineSize = 64>
+struct cache_line_padded {
+  static_assert((LineSize & (LineSize - 1)) == 0,
+                "s21::growth::cache_line_padded LineSize must be a power of "
+                "two");
+
+  static constexpr std::size_t next_capacity(
+      std::size_t size, std::size_t required,
+      std::size_t element_size) noexcept {
+    std::size_t wanted = Base::next_capacity(size, required, element_size);
+    if (!element_size) return wanted;
+    std::size_t bytes =
+        (wanted * element_size + LineSize - 1) & ~(LineSize - 1);
+    return std::max(bytes / element_size, wanted);
+  }
+};
+
+}  // namespace growth
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_GROWTH_POLICY_H
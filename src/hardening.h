@@ -0,0 +1,35 @@
+#ifndef CONTAINERS_CPP_HARDENING_H
+#define CONTAINERS_CPP_HARDENING_H
+
+#include <cstdio>
+#include <cstdlib>
+
+// Precondition checks of the unchecked accessors (operator[], front(),
+// back()). They follow assert(): enabled unless NDEBUG is defined. Define
+// S21_VECTOR_HARDENED to 1 to keep them in release builds, or to 0 to drop
+// them from debug builds.
+#ifndef S21_VECTOR_HARDENED
+#ifdef NDEBUG
+#define S21_VECTOR_HARDENED 0
+#else
+#define S21_VECTOR_HARDENED 1
+#endif
+#endif
+
+namespace s21 {
+
+[[noreturn]] inline void hardening_failure(const char *message) noexcept {
+  std::fprintf(stderr, "%s\n", message);
+  std::abort();
+}
+
+}  // namespace s21
+
+#if S21_VECTOR_HARDENED
+#define S21_VECTOR_ASSERT(condition, message) \
+  ((condition) ? void(0) : ::s21::hardening_failure(message))
+#else
+#define S21_VECTOR_ASSERT(condition, message) void(0)
+#endif
+
+#endif  // CONTAINERS_CPP_HARDENING_H
@@ -0,0 +1,182 @@
+#ifndef CONTAINERS_CPP_HUGE_VECTOR_H
+#define CONTAINERS_CPP_HUGE_VECTOR_H
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+#include "growth_policy.h"
+#include "vector.h"
+
+namespace s21 {
+
+// Allocator mapping blocks of Threshold bytes or more straight from the
+// kernel. Those blocks grow and shrink with mremap, which moves page table
+// entries instead of copying bytes, may be backed by transparent huge pages
+// and can hand their pages back while staying mapped. Smaller blocks come
+// from operator new as usual.
+template <class T, bool HugePages = true,
+          std::size_t Threshold = std::size_t{1} << 20>
+class mmap_allocator {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using is_always_equal = std::true_type;
+
+  template <class U>
+  struct rebind {
+    using other = mmap_allocator<U, HugePages, Threshold>;
+  };
+
+  static constexpr size_type kThreshold = Threshold;
+
+ private:
+  static size_type PageSize() noexcept {
+    static const size_type page =
+        static_cast<size_type>(sysconf(_SC_PAGESIZE));
+    return page;
+  }
+
+  static size_type Bytes(size_type count) {
+    if (count > static_cast<size_type>(-1) / sizeof(T))
+      throw std::bad_alloc();
+    return count * sizeof(T);
+  }
+
+  static bool IsMapped(size_type bytes) noexcept { return bytes >= Threshold; }
+
+  static size_type MapLength(size_type bytes) noexcept {
+    return (bytes + PageSize() - 1) & ~(PageSize() - 1);
+  }
+
+  static void Advise(void *ptr, size_type length) noexcept {
+#ifdef MADV_HUGEPAGE
+    if constexpr (HugePages) madvise(ptr, length, MADV_HUGEPAGE);
+#else
+    static_cast<void>(ptr);
+    static_cast<void>(length);
+#endif
+  }
+
+  static void *Map(size_type bytes) {
+    size_type length = MapLength(bytes);
+    void *ptr = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED) throw std::bad_alloc();
+    Advise(ptr, length);
+    return ptr;
+  }
+
+  static void *Allocate(size_type bytes) {
+    if (IsMapped(bytes)) return Map(bytes);
+    if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+      return ::operator new(bytes, std::align_val_t{alignof(T)});
+    } else {
+      return ::operator new(bytes);
+    }
+  }
+
+  static void Deallocate(void *ptr, size_type bytes) noexcept {
+    if (IsMapped(bytes)) {
+      munmap(ptr, MapLength(bytes));
+    } else if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+      ::operator delete(ptr, std::align_val_t{alignof(T)});
+    } else {
+      ::operator delete(ptr);
+    }
+  }
+
+ public:
+  mmap_allocator() noexcept {}
+
+  template <class U>
+  mmap_allocator(const mmap_allocator<U, HugePages, Threshold> &) noexcept {}
+
+  [[nodiscard]] T *allocate(size_type count) {
+    return static_cast<T *>(Allocate(Bytes(count)));
+  }
+
+  void deallocate(T *ptr, size_type count) noexcept {
+    Deallocate(ptr, count * sizeof(T));
+  }
+
+  // Allocator extension used by s21::vector for trivially relocatable T:
+  // mapped blocks are resized by the kernel without copying
+  [[nodiscard]] T *reallocate(T *ptr, size_type old_count,
+                              size_type new_count) {
+    size_type old_bytes = old_count * sizeof(T);
+    size_type new_bytes = Bytes(new_count);
+#ifdef MREMAP_MAYMOVE
+    if (IsMapped(old_bytes) && IsMapped(new_bytes)) {
+      void *moved = mremap(ptr, MapLength(old_bytes), MapLength(new_bytes),
+                           MREMAP_MAYMOVE);
+      if (moved == MAP_FAILED) throw std::bad_alloc();
+      if (MapLength(new_bytes) > MapLength(old_bytes))
+        Advise(moved, MapLength(new_bytes));
+      return static_cast<T *>(moved);
+    }
+#endif
+    void *moved = Allocate(new_bytes);
+    std::memcpy(moved, ptr, old_bytes < new_bytes ? old_bytes : new_bytes);
+    Deallocate(ptr, old_bytes);
+    return static_cast<T *>(moved);
+  }
+
+  // Gives the whole pages of [ptr, ptr + count) back to the kernel, they
+  // read as zeros afterwards. Heap blocks are left alone.
+  void discard(T *ptr, size_type count) noexcept {
+    size_type bytes = count * sizeof(T);
+    if (!ptr || !IsMapped(bytes)) return;
+    auto begin = reinterpret_cast<std::uintptr_t>(ptr);
+    auto first = (begin + PageSize() - 1) & ~(PageSize() - 1);
+    auto last = (begin + bytes) & ~(PageSize() - 1);
+    if (first < last)
+      madvise(reinterpret_cast<void *>(first), last - first, MADV_DONTNEED);
+  }
+
+  template <class U>
+  bool operator==(
+      const mmap_allocator<U, HugePages, Threshold> &) const noexcept {
+    return true;
+  }
+
+  template <class U>
+  bool operator!=(
+      const mmap_allocator<U, HugePages, Threshold> &) const noexcept {
+    return false;
+  }
+};
+
+// s21::vector for multi-gigabyte buffers of trivially copyable records.
+// Blocks past the allocator threshold live in their own mappings: growth
+// is an mremap instead of a copy, so it never needs old and new block at
+// once, and release_pages()/shrink_to_fit() return memory to the kernel.
+template <class T, bool HugePages = true>
+class huge_vector
+    : public vector<T, mmap_allocator<T, HugePages>, growth::page_granular<>> {
+  static_assert(is_trivially_relocatable_v<T>,
+                "s21::huge_vector T must be trivially relocatable");
+
+  using base = vector<T, mmap_allocator<T, HugePages>, growth::page_granular<>>;
+
+ public:
+  using base::base;
+
+  // Gives the whole pages past size() back to the kernel, the capacity is
+  // kept and faults fresh pages in when filled again. clear() keeps them:
+  // it's the non-virtual s21::vector::clear()
+  void release_pages() noexcept {
+    this->get_allocator().discard(this->data() + this->size(),
+                                  this->capacity() - this->size());
+  }
+};
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_HUGE_VECTOR_H
@@ -0,0 +1,397 @@
+#ifndef CONTAINERS_CPP_MAPPED_VECTOR_H
+#define CONTAINERS_CPP_MAPPED_VECTOR_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "growth_policy.h"
+#include "hardening.h"
+
+namespace s21 {
+
+enum class map_mode {
+  read_only,   // the file has to exist, the elements can't change
+  read_write,  // opens the file, or creates an empty one
+  truncate,    // creates the file, or empties an existing one
+};
+
+// Vector of trivially copyable T living in a file mapped with mmap. Opening
+// maps the file and checks its header, nothing is read or parsed, the
+// kernel pages the elements in on first access. Growth extends the file
+// with ftruncate and remaps it, flush() writes the dirty pages back with
+// msync. Elements are stored in native byte order and layout, a file only
+// opens on a machine with the same element size and alignment.
+template <class T, class GrowthPolicy = growth::page_granular<>>
+class mapped_vector {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "s21::mapped_vector T must be trivially copyable");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  // "S21MVEC" and a zero byte, read as a little-endian integer. A file of
+  // the other byte order fails the check
+  static constexpr std::uint64_t kMagic = 0x0043'4556'4d31'3253;
+  static constexpr std::uint32_t kVersion = 1;
+
+ private:
+  // First bytes of the file, the elements follow
+  struct alignas(64) Header {
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t element_size;
+    std::uint32_t element_align;
+    std::uint32_t reserved;
+    std::uint64_t size;
+    std::uint64_t capacity;
+  };
+
+  static_assert(alignof(T) <= alignof(Header),
+                "s21::mapped_vector T can't be aligned beyond 64 bytes");
+
+  int fd_ = -1;
+  Header *header_ = nullptr;
+  size_type mapped_ = 0;  // bytes
+  bool writable_ = false;
+
+  [[noreturn]] static void Fail(const char *what) {
+    throw std::system_error(errno, std::generic_category(), what);
+  }
+
+  static size_type FileBytes(size_type capacity) noexcept {
+    return sizeof(Header) + capacity * sizeof(value_type);
+  }
+
+  T *Elements() const noexcept {
+    return reinterpret_cast<T *>(reinterpret_cast<char *>(header_) +
+                                 sizeof(Header));
+  }
+
+  void Open(const std::string &path, map_mode mode) {
+    int flags = O_CLOEXEC;
+    if (mode == map_mode::read_only) {
+      flags |= O_RDONLY;
+    } else {
+      flags |= O_RDWR | O_CREAT;
+      if (mode == map_mode::truncate) flags |= O_TRUNC;
+    }
+    fd_ = ::open(path.c_str(), flags, 0644);
+    if (fd_ < 0) Fail("s21::mapped_vector Can't open the file");
+    writable_ = mode != map_mode::read_only;
+
+    struct stat st;
+    if (fstat(fd_, &st) != 0) Fail("s21::mapped_vector Can't stat the file");
+    size_type bytes = static_cast<size_type>(st.st_size);
+    if (bytes == 0 && writable_) {
+      Initialize();
+      return;
+    }
+    if (bytes < sizeof(Header))
+      throw std::runtime_error(
+          "s21::mapped_vector The file is too short for a header");
+    Map(bytes);
+    Validate(bytes);
+  }
+
+  void Initialize() {
+    if (ftruncate(fd_, sizeof(Header)) != 0)
+      Fail("s21::mapped_vector Can't extend the file");
+    Map(sizeof(Header));
+    header_->magic = kMagic;
+    header_->version = kVersion;
+    header_->element_size = sizeof(value_type);
+    header_->element_align = alignof(value_type);
+    header_->reserved = 0;
+    header_->size = 0;
+    header_->capacity = 0;
+  }
+
+  void Validate(size_type bytes) const {
+    if (header_->magic != kMagic)
+      throw std::runtime_error("s21::mapped_vector The file has no header");
+    if (header_->version != kVersion)
+      throw std::runtime_error(
+          "s21::mapped_vector The file has an unsupported version");
+    if (header_->element_size != sizeof(value_type) ||
+        header_->element_align != alignof(value_type))
+      throw std::runtime_error(
+          "s21::mapped_vector The file holds elements of another type");
+    if (header_->size > header_->capacity ||
+        header_->capacity > (bytes - sizeof(Header)) / sizeof(value_type))
+      throw std::runtime_error("s21::mapped_vector The file is truncated");
+  }
+
+  void Map(size_type bytes) {
+    int protection = writable_ ? PROT_READ | PROT_WRITE : PROT_READ;
+    void *ptr = mmap(nullptr, bytes, protection, MAP_SHARED, fd_, 0);
+    if (ptr == MAP_FAILED) Fail("s21::mapped_vector Can't map the file");
+    header_ = static_cast<Header *>(ptr);
+    mapped_ = bytes;
+  }
+
+  void Remap(size_type bytes) {
+#ifdef MREMAP_MAYMOVE
+    void *ptr = mremap(header_, mapped_, bytes, MREMAP_MAYMOVE);
+    if (ptr == MAP_FAILED) Fail("s21::mapped_vector Can't remap the file");
+    header_ = static_cast<Header *>(ptr);
+    mapped_ = bytes;
+#else
+    munmap(header_, mapped_);
+    header_ = nullptr;
+    Map(bytes);
+#endif
+  }
+
+  // Sets the file and the mapping to new_capacity elements
+  void Resize(size_type new_capacity) {
+    size_type bytes = FileBytes(new_capacity);
+    if (bytes > mapped_ && ftruncate(fd_, bytes) != 0)
+      Fail("s21::mapped_vector Can't extend the file");
+    bool shrink = bytes < mapped_;
+    Remap(bytes);
+    // Recorded before the shrink can fail, capacity never exceeds the map
+    header_->capacity = new_capacity;
+    if (shrink && ftruncate(fd_, bytes) != 0)
+      Fail("s21::mapped_vector Can't shrink the file");
+  }
+
+  void RequireWritable() const {
+    if (!writable_)
+      throw std::logic_error(
+          "s21::mapped_vector No file is open for writing");
+  }
+
+  size_type NextCapacity(size_type extra) const {
+    if (extra > max_size() - size())
+      throw std::length_error(
+          "s21::mapped_vector Capacity can't grow beyond max_size()");
+    return std::min<size_type>(
+        GrowthPolicy::next_capacity(size(), size() + extra,
+                                    sizeof(value_type)),
+        max_size());
+  }
+
+  void Close() noexcept {
+    if (header_) munmap(header_, mapped_);
+    if (fd_ >= 0) ::close(fd_);
+    fd_ = -1;
+    header_ = nullptr;
+    mapped_ = 0;
+  }
+
+ public:
+  // Constructors
+  mapped_vector() noexcept {}
+
+  explicit mapped_vector(const std::string &path,
+                         map_mode mode = map_mode::read_write) {
+    try {
+      Open(path, mode);
+    } catch (...) {
+      Close();
+      throw;
+    }
+  }
+
+  mapped_vector(const mapped_vector &) = delete;
+
+  mapped_vector(mapped_vector &&other) noexcept { swap(other); }
+
+  // Destructor, unmaps without flushing: the kernel still writes the pages
+  // back in its own time, flush() first to have them on disk
+  ~mapped_vector() { Close(); }
+
+  mapped_vector &operator=(const mapped_vector &) = delete;
+
+  mapped_vector &operator=(mapped_vector &&other) noexcept {
+    if (this != &other) {
+      mapped_vector tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  bool is_open() const noexcept { return header_ != nullptr; }
+  bool read_only() const noexcept { return !writable_; }
+
+  // Element access
+  reference at(size_type pos) {
+    if (pos >= size())
+      throw std::out_of_range(
+          "s21::mapped_vector::at The index is out of range");
+    return Elements()[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size())
+      throw std::out_of_range(
+          "s21::mapped_vector::at The index is out of range");
+    return Elements()[pos];
+  }
+
+  reference operator[](size_type pos) noexcept {
+    S21_VECTOR_ASSERT(pos < size(),
+                      "s21::mapped_vector::operator[] index out of range");
+    return Elements()[pos];
+  }
+
+  const_reference operator[](size_type pos) const noexcept {
+    S21_VECTOR_ASSERT(pos < size(),
+                      "s21::mapped_vector::operator[] index out of range");
+    return Elements()[pos];
+  }
+
+  reference front() noexcept { return (*this)[0]; }
+  const_reference front() const noexcept { return (*this)[0]; }
+  reference back() noexcept { return (*this)[size() - 1]; }
+  const_reference back() const noexcept { return (*this)[size() - 1]; }
+
+  T *data() noexcept { return header_ ? Elements() : nullptr; }
+  const T *data() const noexcept { return header_ ? Elements() : nullptr; }
+
+  // Iterators
+  iterator begin() noexcept { return data(); }
+  const_iterator begin() const noexcept { return data(); }
+  const_iterator cbegin() const noexcept { return data(); }
+  iterator end() noexcept { return data() + size(); }
+  const_iterator end() const noexcept { return data() + size(); }
+  const_iterator cend() const noexcept { return data() + size(); }
+  reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin() const noexcept {
+    return const_reverse_iterator(end());
+  }
+  reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+  const_reverse_iterator rend() const noexcept {
+    return const_reverse_iterator(begin());
+  }
+
+  // Capacity
+  bool empty() const noexcept { return size() == 0; }
+
+  size_type size() const noexcept {
+    return header_ ? static_cast<size_type>(header_->size) : 0;
+  }
+
+  size_type capacity() const noexcept {
+    return header_ ? static_cast<size_type>(header_->capacity) : 0;
+  }
+
+  size_type max_size() const noexcept {
+    return (static_cast<size_type>(std::numeric_limits<off_t>::max()) -
+            sizeof(Header)) /
+           sizeof(value_type);
+  }
+
+  void reserve(size_type new_capacity) {
+    RequireWritable();
+    if (new_capacity <= capacity()) return;
+    if (new_capacity > max_size())
+      throw std::length_error(
+          "s21::mapped_vector::reserve Reserve capacity can't be larger "
+          "than max_size()");
+    Resize(new_capacity);
+  }
+
+  // Truncates the file to the elements in use
+  void shrink_to_fit() {
+    RequireWritable();
+    if (capacity() != size()) Resize(size());
+  }
+
+  // Modifiers
+  void clear() {
+    RequireWritable();
+    header_->size = 0;
+  }
+
+  template <class... Args>
+  reference emplace_back(Args &&...args) {
+    RequireWritable();
+    // Built first, args may refer to an element the growth remaps
+    T value(std::forward<Args>(args)...);
+    if (size() == capacity()) Resize(NextCapacity(1));
+    T *slot = ::new (static_cast<void *>(Elements() + size())) T(value);
+    ++header_->size;
+    return *slot;
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+
+  void pop_back() {
+    RequireWritable();
+    if (empty())
+      throw std::length_error(
+          "s21::mapped_vector::pop_back Calling pop_back on an empty "
+          "mapped_vector");
+    --header_->size;
+  }
+
+  // Appends [first, last) with one growth of the file at most
+  template <class ForwardIt>
+  void append(ForwardIt first, ForwardIt last) {
+    RequireWritable();
+    size_type count = static_cast<size_type>(std::distance(first, last));
+    if (count > capacity() - size()) Resize(NextCapacity(count));
+    std::copy(first, last, Elements() + size());
+    header_->size += count;
+  }
+
+  void append(std::initializer_list<value_type> values) {
+    append(values.begin(), values.end());
+  }
+
+  void resize(size_type count, value_type value = value_type()) {
+    RequireWritable();
+    if (count > size()) {
+      if (count > capacity()) Resize(NextCapacity(count - size()));
+      std::fill(Elements() + size(), Elements() + count, value);
+    }
+    header_->size = count;
+  }
+
+  // Writes the changed pages back to the file, waiting for the disk unless
+  // async
+  void flush(bool async = false) {
+    if (!writable_ || !header_) return;
+    if (msync(header_, mapped_, async ? MS_ASYNC : MS_SYNC) != 0)
+      Fail("s21::mapped_vector::flush Can't sync the file");
+  }
+
+  void swap(mapped_vector &other) noexcept {
+    std::swap(fd_, other.fd_);
+    std::swap(header_, other.header_);
+    std::swap(mapped_, other.mapped_);
+    std::swap(writable_, other.writable_);
+  }
+};
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_MAPPED_VECTOR_H
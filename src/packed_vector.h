@@ -0,0 +1,346 @@
+#ifndef CONTAINERS_CPP_PACKED_VECTOR_H
+#define CONTAINERS_CPP_PACKED_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "hardening.h"
+#include "vector.h"
+
+namespace s21 {
+
+// Unsigned integers of Bits bits each, stored back to back in 64-bit words
+// with no gaps: a value may straddle two words. 20-bit values take 2.5
+// bytes instead of the 4 of an s21::vector<std::uint32_t>, 4-bit ones half
+// a byte. Access is by value, through get() and set() or proxies, and
+// const_iterator unpacks batch values at a time.
+template <unsigned Bits>
+class packed_vector {
+  static_assert(Bits >= 1 && Bits <= 64,
+                "s21::packed_vector Bits must be from 1 to 64");
+
+ public:
+  // Member types
+  using value_type = std::conditional_t<
+      Bits <= 8, std::uint8_t,
+      std::conditional_t<
+          Bits <= 16, std::uint16_t,
+          std::conditional_t<Bits <= 32, std::uint32_t, std::uint64_t>>>;
+  using word_type = std::uint64_t;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using const_reference = value_type;
+
+  static constexpr unsigned bits = Bits;
+  static constexpr value_type max_value =
+      static_cast<value_type>(~word_type{0} >> (64 - Bits));
+  // Values const_iterator unpacks at once: exactly Bits words
+  static constexpr size_type batch = 64;
+
+ private:
+  static constexpr size_type kWordBits = 64;
+  static constexpr word_type kMask = ~word_type{0} >> (64 - Bits);
+
+  // Words for count values and the zero word after them, which lets Get()
+  // always read two words
+  static constexpr size_type WordsFor(size_type count) noexcept {
+    return (count * Bits + kWordBits - 1) / kWordBits + 1;
+  }
+
+  static word_type Get(const word_type *words, size_type pos) noexcept {
+    size_type bit = pos * Bits;
+    const word_type *word = words + bit / kWordBits;
+    unsigned offset = bit % kWordBits;
+    // The second shift is split in two so an offset of 0 shifts out all
+    // of word[1] instead of shifting by 64
+    return ((word[0] >> offset) | ((word[1] << 1) << (63 - offset))) & kMask;
+  }
+
+  // Value I of a batch, which starts on words[0]: the word and the shifts
+  // are constants
+  template <size_type I>
+  static word_type Extract(const word_type *words) noexcept {
+    constexpr size_type kWord = I * Bits / kWordBits;
+    constexpr unsigned kOffset = I * Bits % kWordBits;
+    if constexpr (kOffset + Bits <= kWordBits) {
+      return (words[kWord] >> kOffset) & kMask;
+    } else {
+      return ((words[kWord] >> kOffset) |
+              (words[kWord + 1] << (kWordBits - kOffset))) &
+             kMask;
+    }
+  }
+
+  template <size_type... I>
+  static void UnpackBatch(const word_type *words, value_type *out,
+                          std::index_sequence<I...>) noexcept {
+    ((out[I] = static_cast<value_type>(Extract<I>(words))), ...);
+  }
+
+  static void Set(word_type *words, size_type pos, word_type value) noexcept {
+    size_type bit = pos * Bits;
+    word_type *word = words + bit / kWordBits;
+    unsigned offset = bit % kWordBits;
+    word[0] = (word[0] & ~(kMask << offset)) | (value << offset);
+    if (offset + Bits > kWordBits) {
+      unsigned done = kWordBits - offset;
+      word[1] = (word[1] & ~(kMask >> done)) | (value >> done);
+    }
+  }
+
+ public:
+  // Proxy for a single value of a non-const packed_vector
+  class reference {
+   public:
+    operator value_type() const noexcept {
+      return static_cast<value_type>(Get(words_, pos_));
+    }
+
+    reference &operator=(value_type value) noexcept {
+      S21_VECTOR_ASSERT(value <= max_value,
+                        "s21::packed_vector::reference The value doesn't "
+                        "fit in Bits");
+      Set(words_, pos_, value & kMask);
+      return *this;
+    }
+
+    reference &operator=(const reference &other) noexcept {
+      return *this = static_cast<value_type>(other);
+    }
+
+   private:
+    friend class packed_vector;
+
+    reference(word_type *words, size_type pos) noexcept
+        : words_(words), pos_(pos) {}
+
+    word_type *words_;
+    size_type pos_;
+  };
+
+  // Forward iterator that unpacks batch values whenever it enters a new
+  // batch, so a scan does word operations instead of a two-word extract
+  // per value
+  class const_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = packed_vector::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = const value_type &;
+    using pointer = const value_type *;
+
+    const_iterator() noexcept = default;
+
+    reference operator*() const noexcept { return buffer_[pos_ % batch]; }
+    pointer operator->() const noexcept { return &buffer_[pos_ % batch]; }
+
+    const_iterator &operator++() noexcept {
+      if (++pos_ % batch == 0 && pos_ < vec_->size_) Fill();
+      return *this;
+    }
+
+    const_iterator operator++(int) noexcept {
+      const_iterator old = *this;
+      ++*this;
+      return old;
+    }
+
+    friend bool operator==(const const_iterator &a,
+                           const const_iterator &b) noexcept {
+      return a.pos_ == b.pos_;
+    }
+    friend bool operator!=(const const_iterator &a,
+                           const const_iterator &b) noexcept {
+      return a.pos_ != b.pos_;
+    }
+
+   private:
+    friend class packed_vector;
+
+    const_iterator(const packed_vector *vec, size_type pos) noexcept
+        : vec_(vec), pos_(pos) {
+      if (pos_ < vec_->size_) Fill();
+    }
+
+    void Fill() noexcept {
+      size_type first = pos_ - pos_ % batch;
+      vec_->unpack(first, std::min(batch, vec_->size_ - first), buffer_);
+    }
+
+    const packed_vector *vec_ = nullptr;
+    size_type pos_ = 0;
+    value_type buffer_[batch] = {};
+  };
+
+  using iterator = const_iterator;
+
+ private:
+  vector<word_type> words_;
+  size_type size_ = 0;
+
+  // Zeroes the bits of values from pos on, up to the end of the words
+  void ClearFrom(size_type pos) noexcept {
+    size_type bit = pos * Bits;
+    size_type word = bit / kWordBits;
+    if (bit % kWordBits) {
+      words_[word] &= ~word_type{0} >> (kWordBits - bit % kWordBits);
+      ++word;
+    }
+    for (; word < words_.size(); ++word) words_[word] = 0;
+  }
+
+  void Grow(size_type count) {
+    if (words_.size() < WordsFor(count))
+      words_.insert(words_.end(), WordsFor(count) - words_.size(), 0);
+  }
+
+ public:
+  // Constructors
+  packed_vector() noexcept = default;
+
+  explicit packed_vector(size_type count, value_type value = 0) {
+    resize(count, value);
+  }
+
+  packed_vector(std::initializer_list<value_type> init) {
+    reserve(init.size());
+    for (value_type value : init) push_back(value);
+  }
+
+  // Iterators
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator end() const noexcept { return const_iterator(this, size_); }
+  const_iterator cend() const noexcept { return end(); }
+
+  // Element access
+  value_type get(size_type pos) const noexcept {
+    S21_VECTOR_ASSERT(pos < size_,
+                      "s21::packed_vector::get The index is out of range");
+    return static_cast<value_type>(Get(words_.data(), pos));
+  }
+
+  // value must fit in Bits, only the low Bits bits are stored
+  void set(size_type pos, value_type value) noexcept {
+    S21_VECTOR_ASSERT(pos < size_,
+                      "s21::packed_vector::set The index is out of range");
+    S21_VECTOR_ASSERT(value <= max_value,
+                      "s21::packed_vector::set The value doesn't fit in "
+                      "Bits");
+    Set(words_.data(), pos, value & kMask);
+  }
+
+  value_type operator[](size_type pos) const noexcept { return get(pos); }
+
+  reference operator[](size_type pos) noexcept {
+    S21_VECTOR_ASSERT(
+        pos < size_,
+        "s21::packed_vector::operator[] The index is out of range");
+    return reference(words_.data(), pos);
+  }
+
+  value_type at(size_type pos) const {
+    if (pos >= size_)
+      throw std::out_of_range(
+          "s21::packed_vector::at The index is out of range");
+    return get(pos);
+  }
+
+  value_type front() const noexcept { return get(0); }
+  value_type back() const noexcept { return get(size_ - 1); }
+
+  // Copies the values [first, first + count) to out
+  void unpack(size_type first, size_type count,
+              value_type *out) const noexcept {
+    S21_VECTOR_ASSERT(
+        first <= size_ && count <= size_ - first,
+        "s21::packed_vector::unpack The range is out of range");
+    const word_type *words = words_.data();
+    if (first % batch == 0 && count == batch) {
+      UnpackBatch(words + first / batch * Bits, out,
+                  std::make_index_sequence<batch>());
+      return;
+    }
+    for (size_type i = 0; i < count; ++i)
+      out[i] = static_cast<value_type>(Get(words, first + i));
+  }
+
+  // The packed words, value i in bits [i * Bits, (i + 1) * Bits)
+  const word_type *data() const noexcept { return words_.data(); }
+
+  // Capacity
+  [[nodiscard]] bool empty() const noexcept { return !size_; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept {
+    return words_.capacity() ? (words_.capacity() - 1) * kWordBits / Bits : 0;
+  }
+  void reserve(size_type count) { words_.reserve(WordsFor(count)); }
+  void shrink_to_fit() { words_.shrink_to_fit(); }
+
+  // Modifiers
+  void clear() noexcept {
+    words_.clear();
+    size_ = 0;
+  }
+
+  void push_back(value_type value) {
+    S21_VECTOR_ASSERT(value <= max_value,
+                      "s21::packed_vector::push_back The value doesn't fit "
+                      "in Bits");
+    Grow(size_ + 1);
+    Set(words_.data(), size_++, value & kMask);
+  }
+
+  void pop_back() {
+    if (!size_)
+      throw std::length_error(
+          "s21::packed_vector::pop_back Calling pop_back on an empty "
+          "container");
+    Set(words_.data(), --size_, 0);
+  }
+
+  void resize(size_type count, value_type value = 0) {
+    if (count <= size_) {
+      if (!count) return clear();
+      ClearFrom(count);
+      words_.erase(words_.begin() + WordsFor(count), words_.end());
+      size_ = count;
+      return;
+    }
+    Grow(count);
+    if (value & kMask)
+      for (size_type i = size_; i < count; ++i)
+        Set(words_.data(), i, value & kMask);
+    size_ = count;
+  }
+
+  void swap(packed_vector &other) noexcept {
+    words_.swap(other.words_);
+    std::swap(size_, other.size_);
+  }
+
+  // The bits past size() are always zero, so equal values mean equal words
+  friend bool operator==(const packed_vector &a,
+                         const packed_vector &b) noexcept {
+    if (a.size_ != b.size_) return false;
+    if (!a.size_) return true;
+    for (size_type i = 0; i + 1 < WordsFor(a.size_); ++i)
+      if (a.words_[i] != b.words_[i]) return false;
+    return true;
+  }
+
+  friend bool operator!=(const packed_vector &a,
+                         const packed_vector &b) noexcept {
+    return !(a == b);
+  }
+};
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_PACKED_VECTOR_H
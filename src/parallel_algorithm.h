@@ -0,0 +1,288 @@
+#ifndef CONTAINERS_CPP_PARALLEL_ALGORITHM_H
+#define CONTAINERS_CPP_PARALLEL_ALGORITHM_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "thread_pool.h"
+#include "vector.h"
+
+namespace s21 {
+
+// for_each, transform, reduce, sort and stable_partition over random access
+// ranges such as s21::vector iterators, run on a thread_pool. The range is
+// cut into chunks of policy::grain elements, each a task of the pool.
+namespace parallel {
+
+struct policy {
+  // nullptr is thread_pool::default_pool()
+  thread_pool *pool = nullptr;
+  // Elements per task, 0 picks about four chunks per thread but not less
+  // than kMinGrain elements. Cheap operations want large chunks, uneven
+  // ones smaller chunks to balance the load
+  std::size_t grain = 0;
+  // reduce() combines the chunk results in range order, with chunks that
+  // don't depend on the number of threads, so the result is the same on
+  // every run and every pool, even for floating point
+  bool deterministic = false;
+
+  static constexpr std::size_t kMinGrain = 2048;
+
+  thread_pool &Pool() const {
+    return pool ? *pool : thread_pool::default_pool();
+  }
+
+  std::size_t Grain(std::size_t count) const {
+    if (grain) return grain;
+    if (deterministic) return kMinGrain * 4;
+    std::size_t chunks = Pool().concurrency() * 4;
+    return std::max(kMinGrain, (count + chunks - 1) / chunks);
+  }
+};
+
+namespace detail {
+
+// Calls body(begin, end) for the chunks of [0, count) on the pool, the
+// first one on the calling thread
+template <class Body>
+void ForChunks(const policy &p, std::size_t count, std::size_t grain,
+               Body &&body) {
+  if (count <= grain || p.Pool().size() == 0) {
+    for (std::size_t begin = 0; begin < count; begin += grain)
+      body(begin, std::min(count, begin + grain));
+    return;
+  }
+  task_group group(p.Pool());
+  for (std::size_t begin = grain; begin < count; begin += grain) {
+    std::size_t end = std::min(count, begin + grain);
+    group.run([&body, begin, end] { body(begin, end); });
+  }
+  body(std::size_t{0}, grain);
+  group.wait();
+}
+
+// Merges the sorted [first1, last1) and [first2, last2) into out by moving,
+// splitting the larger range at its middle while there's more than grain.
+// A split that leaves the whole problem on one side, possible once a range
+// is down to one element, ends the splitting
+template <class It, class OutIt, class Compare>
+void Merge(task_group &group, It first1, It last1, It first2, It last2,
+           OutIt out, Compare comp, std::size_t grain) {
+  std::size_t size1 = last1 - first1;
+  std::size_t size2 = last2 - first2;
+  It middle1 = first1, middle2 = first2;
+  if (size1 + size2 > grain && std::max(size1, size2) > 1) {
+    if (size1 >= size2) {
+      middle1 = first1 + size1 / 2;
+      middle2 = std::lower_bound(first2, last2, *middle1, comp);
+    } else {
+      middle2 = first2 + size2 / 2;
+      middle1 = std::upper_bound(first1, last1, *middle2, comp);
+    }
+  }
+  if (middle1 == first1 && middle2 == first2) {
+    std::merge(std::make_move_iterator(first1), std::make_move_iterator(last1),
+               std::make_move_iterator(first2), std::make_move_iterator(last2),
+               out, comp);
+    return;
+  }
+  OutIt out_middle = out + (middle1 - first1) + (middle2 - first2);
+  group.run([=, &group] {
+    Merge(group, middle1, last1, middle2, last2, out_middle, comp, grain);
+  });
+  Merge(group, first1, middle1, first2, middle2, out, comp, grain);
+}
+
+// Sorts [data, data + count) into data, or into other if to_other. Both
+// ranges hold constructed elements, the values are in data
+template <class It, class Other, class Compare>
+void MergeSort(thread_pool &pool, It data, Other other, std::size_t count,
+               bool to_other, Compare comp, std::size_t grain) {
+  if (count <= grain) {
+    std::sort(data, data + count, comp);
+    if (to_other) std::move(data, data + count, other);
+    return;
+  }
+  std::size_t half = count / 2;
+  {
+    // The halves go to the range the merge reads from
+    task_group halves(pool);
+    halves.run([=, &pool] {
+      MergeSort(pool, data + half, other + half, count - half, !to_other,
+                comp, grain);
+    });
+    MergeSort(pool, data, other, half, !to_other, comp, grain);
+    halves.wait();
+  }
+  task_group merge(pool);
+  if (to_other) {
+    Merge(merge, data, data + half, data + half, data + count, other, comp,
+          grain);
+  } else {
+    Merge(merge, other, other + half, other + half, other + count, data,
+          comp, grain);
+  }
+  merge.wait();
+}
+
+template <class T, class It, class BinaryOp>
+T Fold(It first, It last, BinaryOp &op) {
+  T result = *first;
+  for (++first; first != last; ++first)
+    result = op(std::move(result), *first);
+  return result;
+}
+
+// Keeps the overloads without a policy out of the way of those with one
+template <class It>
+using RequireIterator =
+    std::enable_if_t<!std::is_same_v<std::decay_t<It>, policy>, int>;
+
+}  // namespace detail
+
+template <class RandomIt, class UnaryFunction>
+void for_each(const policy &p, RandomIt first, RandomIt last,
+              UnaryFunction f) {
+  std::size_t count = last - first;
+  detail::ForChunks(p, count, p.Grain(count),
+                    [first, &f](std::size_t begin, std::size_t end) {
+                      for (std::size_t i = begin; i < end; ++i) f(first[i]);
+                    });
+}
+
+template <class RandomIt, class UnaryFunction,
+          detail::RequireIterator<RandomIt> = 0>
+void for_each(RandomIt first, RandomIt last, UnaryFunction f) {
+  for_each(policy{}, first, last, std::move(f));
+}
+
+// Writes op(x) of every x of [first, last) to the range at d_first, which
+// may be [first, last) itself
+template <class RandomIt, class OutputIt, class UnaryOperation>
+OutputIt transform(const policy &p, RandomIt first, RandomIt last,
+                   OutputIt d_first, UnaryOperation op) {
+  std::size_t count = last - first;
+  detail::ForChunks(p, count, p.Grain(count),
+                    [first, d_first, &op](std::size_t begin, std::size_t end) {
+                      for (std::size_t i = begin; i < end; ++i)
+                        d_first[i] = op(first[i]);
+                    });
+  return d_first + count;
+}
+
+template <class RandomIt, class OutputIt, class UnaryOperation,
+          detail::RequireIterator<RandomIt> = 0>
+OutputIt transform(RandomIt first, RandomIt last, OutputIt d_first,
+                   UnaryOperation op) {
+  return transform(policy{}, first, last, d_first, std::move(op));
+}
+
+// Combines init and the elements with op, which has to be associative and,
+// unless p.deterministic, commutative: chunk results are combined in the
+// order the chunks finish
+template <class RandomIt, class T, class BinaryOp = std::plus<>>
+T reduce(const policy &p, RandomIt first, RandomIt last, T init,
+         BinaryOp op = {}) {
+  std::size_t count = last - first;
+  std::size_t grain = p.Grain(count);
+  if (p.deterministic) {
+    s21::vector<std::optional<T>> partials((count + grain - 1) / grain);
+    detail::ForChunks(p, count, grain,
+                      [&](std::size_t begin, std::size_t end) {
+                        partials[begin / grain] = detail::Fold<T>(
+                            first + begin, first + end, op);
+                      });
+    for (std::optional<T> &partial : partials)
+      init = op(std::move(init), std::move(*partial));
+    return init;
+  }
+  std::mutex mutex;
+  detail::ForChunks(p, count, grain, [&](std::size_t begin, std::size_t end) {
+    T partial = detail::Fold<T>(first + begin, first + end, op);
+    std::lock_guard<std::mutex> lock(mutex);
+    init = op(std::move(init), std::move(partial));
+  });
+  return init;
+}
+
+template <class RandomIt, class T, class BinaryOp = std::plus<>,
+          detail::RequireIterator<RandomIt> = 0>
+T reduce(RandomIt first, RandomIt last, T init, BinaryOp op = {}) {
+  return reduce(policy{}, first, last, std::move(init), std::move(op));
+}
+
+// Merge sort: the chunks are sorted with std::sort, then merged pairwise,
+// each merge split into tasks as well. Not stable, like std::sort; needs
+// room for a copy of the range
+template <class RandomIt, class Compare = std::less<>>
+void sort(const policy &p, RandomIt first, RandomIt last, Compare comp = {}) {
+  using value_type = typename std::iterator_traits<RandomIt>::value_type;
+  std::size_t count = last - first;
+  std::size_t grain = p.Grain(count);
+  thread_pool &pool = p.Pool();
+  if (count <= grain || pool.size() == 0) {
+    std::sort(first, last, comp);
+    return;
+  }
+  s21::vector<value_type> buffer(std::make_move_iterator(first),
+                                 std::make_move_iterator(last));
+  detail::MergeSort(pool, buffer.begin(), first, count, true, comp, grain);
+}
+
+template <class RandomIt, class Compare = std::less<>,
+          detail::RequireIterator<RandomIt> = 0>
+void sort(RandomIt first, RandomIt last, Compare comp = {}) {
+  sort(policy{}, first, last, std::move(comp));
+}
+
+// Moves the elements satisfying pred before the others, keeping the order
+// within both groups, and returns the first of the others. pred is called
+// once per element. Needs room for a copy of the range
+template <class RandomIt, class UnaryPredicate>
+RandomIt stable_partition(const policy &p, RandomIt first, RandomIt last,
+                          UnaryPredicate pred) {
+  using value_type = typename std::iterator_traits<RandomIt>::value_type;
+  std::size_t count = last - first;
+  std::size_t grain = p.Grain(count);
+  std::size_t chunks = (count + grain - 1) / grain;
+  s21::vector<unsigned char> selected(count);
+  s21::vector<std::size_t> selected_before(chunks + 1);
+  detail::ForChunks(p, count, grain, [&](std::size_t begin, std::size_t end) {
+    std::size_t sum = 0;
+    for (std::size_t i = begin; i < end; ++i) {
+      selected[i] = pred(first[i]) ? 1 : 0;
+      sum += selected[i];
+    }
+    selected_before[begin / grain + 1] = sum;
+  });
+  for (std::size_t chunk = 0; chunk < chunks; ++chunk)
+    selected_before[chunk + 1] += selected_before[chunk];
+  const std::size_t total = selected_before[chunks];
+
+  s21::vector<value_type> buffer(std::make_move_iterator(first),
+                                 std::make_move_iterator(last));
+  detail::ForChunks(p, count, grain, [&](std::size_t begin, std::size_t end) {
+    std::size_t selected_at = selected_before[begin / grain];
+    std::size_t other_at = total + begin - selected_at;
+    for (std::size_t i = begin; i < end; ++i)
+      first[selected[i] ? selected_at++ : other_at++] = std::move(buffer[i]);
+  });
+  return first + total;
+}
+
+template <class RandomIt, class UnaryPredicate,
+          detail::RequireIterator<RandomIt> = 0>
+RandomIt stable_partition(RandomIt first, RandomIt last, UnaryPredicate pred) {
+  return stable_partition(policy{}, first, last, std::move(pred));
+}
+
+}  // namespace parallel
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_PARALLEL_ALGORITHM_H
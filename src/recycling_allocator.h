@@ -0,0 +1,357 @@
+#ifndef CONTAINERS_CPP_RECYCLING_ALLOCATOR_H
+#define CONTAINERS_CPP_RECYCLING_ALLOCATOR_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+#include "growth_policy.h"
+#include "vector.h"
+
+namespace s21 {
+
+// Process wide cache of freed heap blocks. Blocks of up to max_block bytes
+// are rounded up to a power of two, freed ones go to a free list of their
+// size class in the freeing thread and the next allocation of that class
+// in the thread pops them again without touching the global heap.
+//
+// Each thread keeps a bounded number of blocks per class. The surplus, and
+// the whole cache of an exiting thread, moves in batches to a shared list
+// guarded by a mutex, where threads whose own list ran dry refill from.
+// Blocks freed by another thread than the one allocating them are fine:
+// they are plain heap blocks and simply migrate. Past the shared limit
+// blocks go back to the heap, trim() gives back everything cached.
+class recycling_pool {
+ public:
+  using size_type = std::size_t;
+
+  static constexpr size_type min_block = 16;
+  static constexpr size_type max_block = size_type{1} << 20;
+
+  // Calls into the global heap and the bytes obtained from it, cached
+  // blocks included
+  struct statistics {
+    size_type upstream_allocations;
+    size_type upstream_deallocations;
+    size_type upstream_bytes;
+    size_type peak_upstream_bytes;
+  };
+
+ private:
+  static constexpr unsigned kMinShift = 4;
+  static constexpr unsigned kClasses = 17;
+  // Per class and thread: at most this many bytes and kMaxThreadBlocks
+  static constexpr size_type kThreadClassBytes = size_type{256} << 10;
+  static constexpr size_type kMaxThreadBlocks = 64;
+  // The shared list of a class holds that many thread caches worth
+  static constexpr size_type kSharedFactor = 8;
+
+  static_assert(min_block << (kClasses - 1) == max_block,
+                "s21::recycling_pool The classes must end at max_block");
+
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+
+  struct FreeList {
+    FreeBlock *head = nullptr;
+    size_type count = 0;
+
+    void Push(FreeBlock *block) noexcept {
+      block->next = head;
+      head = block;
+      ++count;
+    }
+
+    FreeBlock *Pop() noexcept {
+      FreeBlock *block = head;
+      head = block->next;
+      --count;
+      return block;
+    }
+    // Unlinks up to n blocks from the front as a chain of their own
+    FreeList Split(size_type n) noexcept {
+      FreeList front;
+      while (head && front.count < n) front.Push(Pop());
+      return front;
+    }
+
+    void Splice(FreeList &other) noexcept {
+      while (other.head) Push(other.Pop());
+    }
+  };
+
+  // Trivially destructible, so it stays usable after the thread's
+  // destructors ran; exited then routes everything to the heap
+  struct ThreadCache {
+    FreeList lists[kClasses];
+    bool registered = false;
+    bool exited = false;
+  };
+
+  struct SharedList {
+    std::mutex mutex;
+    FreeList list;
+  };
+
+  struct Shared {
+    SharedList lists[kClasses];
+    std::atomic<size_type> allocations{0};
+    std::atomic<size_type> deallocations{0};
+    std::atomic<size_type> bytes{0};
+    std::atomic<size_type> peak_bytes{0};
+  };
+
+  // Never destroyed: vectors with static storage may free their buffers
+  // after every destructor would have run
+  static Shared &Global() noexcept {
+    static Shared *shared = new Shared;
+    return *shared;
+  }
+
+  static ThreadCache &Cache() noexcept {
+    static thread_local ThreadCache cache;
+    return cache;
+  }
+
+  struct ThreadExit {
+    ~ThreadExit() {
+      ThreadCache &cache = Cache();
+      for (unsigned c = 0; c < kClasses; ++c)
+        GiveToShared(c, cache.lists[c]);
+      cache.exited = true;
+    }
+  };
+
+  static void RegisterExit(ThreadCache &cache) {
+    if (cache.registered) return;
+    static thread_local ThreadExit exit;
+    static_cast<void>(exit);
+    cache.registered = true;
+  }
+
+  static unsigned Class(size_type bytes) noexcept {
+    if (bytes <= min_block) return 0;
+    return 64 - static_cast<unsigned>(__builtin_clzll(bytes - 1)) -
+           kMinShift;
+  }
+
+  static constexpr size_type ClassBytes(unsigned c) noexcept {
+    return min_block << c;
+  }
+
+  static constexpr size_type ThreadLimit(unsigned c) noexcept {
+    return std::clamp<size_type>(kThreadClassBytes / ClassBytes(c), 1,
+                                 kMaxThreadBlocks);
+  }
+
+  static void *Upstream(size_type bytes) {
+    void *ptr = ::operator new(bytes);
+    Shared &shared = Global();
+    shared.allocations.fetch_add(1, std::memory_order_relaxed);
+    size_type held =
+        shared.bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    size_type peak = shared.peak_bytes.load(std::memory_order_relaxed);
+    while (peak < held && !shared.peak_bytes.compare_exchange_weak(
+                              peak, held, std::memory_order_relaxed)) {
+    }
+    return ptr;
+  }
+
+  static void ReleaseUpstream(void *ptr, size_type bytes) noexcept {
+    Shared &shared = Global();
+    shared.deallocations.fetch_add(1, std::memory_order_relaxed);
+    shared.bytes.fetch_sub(bytes, std::memory_order_relaxed);
+    ::operator delete(ptr, bytes);
+  }
+
+  static void ReleaseAll(unsigned c, FreeList &list) noexcept {
+    while (list.head) ReleaseUpstream(list.Pop(), ClassBytes(c));
+  }
+  // Moves list to the shared list of class c, what doesn't fit goes back
+  // to the heap
+  static void GiveToShared(unsigned c, FreeList &list) noexcept {
+    if (!list.head) return;
+    SharedList &shared = Global().lists[c];
+    {
+      std::lock_guard<std::mutex> lock(shared.mutex);
+      size_type limit = kSharedFactor * ThreadLimit(c);
+      if (shared.list.count < limit) {
+        FreeList kept = list.Split(limit - shared.list.count);
+        shared.list.Splice(kept);
+      }
+    }
+    ReleaseAll(c, list);
+  }
+
+  static void Refill(unsigned c, FreeList &list) {
+    SharedList &shared = Global().lists[c];
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    FreeList batch = shared.list.Split(std::max<size_type>(
+        ThreadLimit(c) / 2, 1));
+    list.Splice(batch);
+  }
+
+ public:
+  // A block of at least bytes bytes, aligned like operator new
+  [[nodiscard]] static void *allocate(size_type bytes) {
+    if (bytes > max_block) return Upstream(bytes);
+    unsigned c = Class(bytes);
+    ThreadCache &cache = Cache();
+    FreeList &list = cache.lists[c];
+    if (!list.head && !cache.exited) {
+      RegisterExit(cache);
+      Refill(c, list);
+    }
+    if (list.head) return list.Pop();
+    return Upstream(ClassBytes(c));
+  }
+  // bytes must be the size the block was allocated with
+  static void deallocate(void *ptr, size_type bytes) noexcept {
+    if (bytes > max_block) return ReleaseUpstream(ptr, bytes);
+    unsigned c = Class(bytes);
+    ThreadCache &cache = Cache();
+    if (cache.exited) return ReleaseUpstream(ptr, ClassBytes(c));
+    RegisterExit(cache);
+    FreeList &list = cache.lists[c];
+    list.Push(static_cast<FreeBlock *>(ptr));
+    if (list.count > ThreadLimit(c)) {
+      FreeList surplus = list.Split(list.count - ThreadLimit(c) / 2);
+      GiveToShared(c, surplus);
+    }
+  }
+  // Resizes a block keeping its first min(old_bytes, new_bytes) bytes, in
+  // place while both sizes fall into the same class
+  [[nodiscard]] static void *reallocate(void *ptr, size_type old_bytes,
+                                        size_type new_bytes) {
+    if (old_bytes <= max_block && new_bytes <= max_block &&
+        Class(old_bytes) == Class(new_bytes))
+      return ptr;
+    void *moved = allocate(new_bytes);
+    std::memcpy(moved, ptr, std::min(old_bytes, new_bytes));
+    deallocate(ptr, old_bytes);
+    return moved;
+  }
+  // Returns the blocks cached by the calling thread and the shared lists
+  // to the heap. Other threads keep their own caches.
+  static void trim() noexcept {
+    ThreadCache &cache = Cache();
+    for (unsigned c = 0; c < kClasses; ++c) {
+      ReleaseAll(c, cache.lists[c]);
+      SharedList &shared = Global().lists[c];
+      FreeList list;
+      {
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        list = shared.list.Split(shared.list.count);
+      }
+      ReleaseAll(c, list);
+    }
+  }
+
+  // Starts a new peak_upstream_bytes from what is held now
+  static void reset_peak() noexcept {
+    Shared &shared = Global();
+    shared.peak_bytes.store(shared.bytes.load(std::memory_order_relaxed),
+                            std::memory_order_relaxed);
+  }
+
+  static statistics stats() noexcept {
+    const Shared &shared = Global();
+    return {shared.allocations.load(std::memory_order_relaxed),
+            shared.deallocations.load(std::memory_order_relaxed),
+            shared.bytes.load(std::memory_order_relaxed),
+            shared.peak_bytes.load(std::memory_order_relaxed)};
+  }
+};
+
+// Allocator drawing from recycling_pool: short-lived containers reuse the
+// blocks of the ones destroyed before them instead of calling new and
+// delete. Types aligned beyond operator new bypass the pool.
+template <class T>
+class recycling_allocator {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using is_always_equal = std::true_type;
+
+  template <class U>
+  struct rebind {
+    using other = recycling_allocator<U>;
+  };
+
+ private:
+  static constexpr bool kPooled =
+      alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+  static size_type Bytes(size_type count) {
+    if (count > static_cast<size_type>(
+                    std::numeric_limits<difference_type>::max()) /
+                    sizeof(T))
+      throw std::bad_array_new_length();
+    return count * sizeof(T);
+  }
+
+ public:
+  recycling_allocator() noexcept {}
+
+  template <class U>
+  recycling_allocator(const recycling_allocator<U> &) noexcept {}
+
+  [[nodiscard]] T *allocate(size_type count) {
+    if constexpr (kPooled) {
+      return static_cast<T *>(recycling_pool::allocate(Bytes(count)));
+    } else {
+      return static_cast<T *>(
+          ::operator new(Bytes(count), std::align_val_t{alignof(T)}));
+    }
+  }
+
+  void deallocate(T *ptr, size_type count) noexcept {
+    if constexpr (kPooled) {
+      recycling_pool::deallocate(ptr, count * sizeof(T));
+    } else {
+      ::operator delete(ptr, std::align_val_t{alignof(T)});
+    }
+  }
+  // Allocator extension used by s21::vector for trivially relocatable T:
+  // growth inside the block's size class keeps the block
+  [[nodiscard]] T *reallocate(T *ptr, size_type old_count,
+                              size_type new_count) {
+    if constexpr (kPooled) {
+      return static_cast<T *>(recycling_pool::reallocate(
+          ptr, old_count * sizeof(T), Bytes(new_count)));
+    } else {
+      T *moved = allocate(new_count);
+      std::memcpy(static_cast<void *>(moved), ptr,
+                  std::min(old_count, new_count) * sizeof(T));
+      deallocate(ptr, old_count);
+      return moved;
+    }
+  }
+
+  template <class U>
+  bool operator==(const recycling_allocator<U> &) const noexcept {
+    return true;
+  }
+
+  template <class U>
+  bool operator!=(const recycling_allocator<U> &) const noexcept {
+    return false;
+  }
+};
+
+// s21::vector for buffers created and dropped at a high rate, e.g. per
+// request. Capacities fill the power of two blocks of the pool.
+template <class T>
+using recycling_vector =
+    vector<T, recycling_allocator<T>, growth::power_of_two>;
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_RECYCLING_ALLOCATOR_H
@@ -0,0 +1,405 @@
+#ifndef CONTAINERS_CPP_SEGMENTED_VECTOR_H
+#define CONTAINERS_CPP_SEGMENTED_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "hardening.h"
+#include "vector.h"
+
+namespace s21 {
+
+// Elements per chunk by default: as many as fit 4 KiB, rounded down to a
+// power of two, at least one
+template <class T>
+constexpr std::size_t default_chunk_size() noexcept {
+  std::size_t fit = sizeof(T) < 4096 ? 4096 / sizeof(T) : 1;
+  std::size_t size = 1;
+  while (size * 2 <= fit) size *= 2;
+  return size;
+}
+
+// Vector of fixed size chunks behind a small chunk index. Growing adds a
+// chunk and never moves an element, so pointers and references stay valid
+// until the element is removed, and push_back()/pop_back() are O(1)
+// without relocation. Element i is chunk i / ChunkSize, slot i % ChunkSize,
+// a shift and a mask. Like std::deque, iterators are invalidated when the
+// chunk index grows. for_each_chunk() hands out contiguous runs, so loops
+// over them vectorize like loops over an s21::vector.
+template <class T, std::size_t ChunkSize = default_chunk_size<T>()>
+class segmented_vector {
+  static_assert(ChunkSize > 0 && (ChunkSize & (ChunkSize - 1)) == 0,
+                "s21::segmented_vector ChunkSize must be a power of two");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  static constexpr size_type chunk_size = ChunkSize;
+
+ private:
+  static constexpr size_type kShift = __builtin_ctzll(ChunkSize);
+  static constexpr size_type kMask = ChunkSize - 1;
+
+  // Chunks in use, then spare ones, then a null sentinel iterators may step
+  // onto past the last chunk. Empty until the first chunk is allocated
+  vector<T *> chunks_;
+  size_type size_ = 0;
+
+  static T *const *Sentinel() noexcept {
+    static T *const sentinel = nullptr;
+    return &sentinel;
+  }
+
+  T *const *Node(size_type chunk) const noexcept {
+    return chunks_.empty() ? Sentinel() : chunks_.data() + chunk;
+  }
+
+  size_type Chunks() const noexcept {
+    return chunks_.empty() ? 0 : chunks_.size() - 1;
+  }
+
+  static T *AllocateChunk() { return std::allocator<T>().allocate(ChunkSize); }
+
+  static void FreeChunk(T *chunk) noexcept {
+    std::allocator<T>().deallocate(chunk, ChunkSize);
+  }
+
+  void AddChunk() {
+    if (chunks_.empty()) chunks_.push_back(nullptr);
+    chunks_.push_back(nullptr);
+    try {
+      chunks_[chunks_.size() - 2] = AllocateChunk();
+    } catch (...) {
+      chunks_.pop_back();
+      throw;
+    }
+  }
+
+  template <class Iterator>
+  class Iter {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Iterator *;
+    using reference = Iterator &;
+
+    Iter() noexcept = default;
+
+    // iterator converts to const_iterator
+    template <class Other,
+              class = std::enable_if_t<std::is_same_v<Iterator, const T> &&
+                                       std::is_same_v<Other, T>>>
+    Iter(const Iter<Other> &other) noexcept
+        : cur_(other.cur_), node_(other.node_) {}
+
+    reference operator*() const noexcept { return *cur_; }
+    pointer operator->() const noexcept { return cur_; }
+    reference operator[](difference_type n) const noexcept {
+      return *(*this + n);
+    }
+
+    Iter &operator++() noexcept {
+      if (++cur_ == *node_ + ChunkSize) cur_ = *++node_;
+      return *this;
+    }
+    Iter operator++(int) noexcept {
+      Iter tmp = *this;
+      ++*this;
+      return tmp;
+    }
+    Iter &operator--() noexcept {
+      if (cur_ == *node_) cur_ = *--node_ + ChunkSize;
+      --cur_;
+      return *this;
+    }
+    Iter operator--(int) noexcept {
+      Iter tmp = *this;
+      --*this;
+      return tmp;
+    }
+    Iter &operator+=(difference_type n) noexcept {
+      difference_type offset = (cur_ - *node_) + n;
+      if (offset >= 0 && offset < static_cast<difference_type>(ChunkSize)) {
+        cur_ += n;
+      } else {
+        difference_type chunks =
+            offset >= 0 ? offset >> kShift : -((-offset - 1) >> kShift) - 1;
+        node_ += chunks;
+        cur_ = *node_ + (offset - chunks * static_cast<difference_type>(
+                                              ChunkSize));
+      }
+      return *this;
+    }
+    Iter &operator-=(difference_type n) noexcept { return *this += -n; }
+
+    friend Iter operator+(Iter it, difference_type n) noexcept {
+      return it += n;
+    }
+    friend Iter operator+(difference_type n, Iter it) noexcept {
+      return it += n;
+    }
+    friend Iter operator-(Iter it, difference_type n) noexcept {
+      return it -= n;
+    }
+    friend difference_type operator-(const Iter &a, const Iter &b) noexcept {
+      return (a.node_ - b.node_) * static_cast<difference_type>(ChunkSize) +
+             (a.cur_ - *a.node_) - (b.cur_ - *b.node_);
+    }
+    friend bool operator==(const Iter &a, const Iter &b) noexcept {
+      return a.cur_ == b.cur_;
+    }
+    friend bool operator!=(const Iter &a, const Iter &b) noexcept {
+      return a.cur_ != b.cur_;
+    }
+    friend bool operator<(const Iter &a, const Iter &b) noexcept {
+      return a.node_ < b.node_ || (a.node_ == b.node_ && a.cur_ < b.cur_);
+    }
+    friend bool operator>(const Iter &a, const Iter &b) noexcept {
+      return b < a;
+    }
+    friend bool operator<=(const Iter &a, const Iter &b) noexcept {
+      return !(b < a);
+    }
+    friend bool operator>=(const Iter &a, const Iter &b) noexcept {
+      return !(a < b);
+    }
+
+   private:
+    friend class segmented_vector;
+    template <class>
+    friend class Iter;
+
+    Iter(T *const *node, size_type offset) noexcept
+        : cur_(*node + offset), node_(node) {}
+
+    Iterator *cur_ = nullptr;
+    T *const *node_ = nullptr;
+  };
+
+ public:
+  using iterator = Iter<T>;
+  using const_iterator = Iter<const T>;
+
+  // Constructors
+  segmented_vector() noexcept {}
+
+  segmented_vector(size_type count, const_reference value)
+      : segmented_vector() {
+    reserve(count);
+    for (size_type i = 0; i < count; ++i) push_back(value);
+  }
+
+  segmented_vector(std::initializer_list<value_type> const &init)
+      : segmented_vector() {
+    reserve(init.size());
+    for (const_reference value : init) push_back(value);
+  }
+
+  // Copies chunk by chunk into chunks of its own
+  segmented_vector(const segmented_vector &other) : segmented_vector() {
+    reserve(other.size_);
+    other.for_each_chunk([this](const T *first, const T *last) {
+      std::uninitialized_copy(first, last, chunks_[size_ >> kShift]);
+      size_ += last - first;
+    });
+  }
+
+  segmented_vector(segmented_vector &&other) noexcept
+      : chunks_(std::move(other.chunks_)),
+        size_(std::exchange(other.size_, 0)) {}
+
+  // Destructor
+  ~segmented_vector() {
+    clear();
+    for (size_type k = 0; k < Chunks(); ++k) FreeChunk(chunks_[k]);
+  }
+
+  segmented_vector &operator=(segmented_vector &&other) noexcept {
+    if (this != &other) {
+      segmented_vector tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  segmented_vector &operator=(const segmented_vector &other) {
+    if (this != &other) {
+      segmented_vector tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  iterator begin() noexcept { return iterator(Node(0), 0); }
+
+  const_iterator begin() const noexcept { return const_iterator(Node(0), 0); }
+
+  iterator end() noexcept {
+    return iterator(Node(size_ >> kShift), size_ & kMask);
+  }
+
+  const_iterator end() const noexcept {
+    return const_iterator(Node(size_ >> kShift), size_ & kMask);
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size_)
+      throw std::out_of_range(
+          "s21::segmented_vector::at The index is out of range");
+    return (*this)[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size_)
+      throw std::out_of_range(
+          "s21::segmented_vector::at The index is out of range");
+    return (*this)[pos];
+  }
+
+  // Unchecked access, pos must be less than size()
+  reference operator[](size_type pos) noexcept {
+    S21_VECTOR_ASSERT(pos < size_,
+                      "s21::segmented_vector::operator[] Index out of range");
+    return chunks_[pos >> kShift][pos & kMask];
+  }
+
+  const_reference operator[](size_type pos) const noexcept {
+    S21_VECTOR_ASSERT(pos < size_,
+                      "s21::segmented_vector::operator[] Index out of range");
+    return chunks_[pos >> kShift][pos & kMask];
+  }
+
+  reference front() noexcept {
+    S21_VECTOR_ASSERT(size_ != 0,
+                      "s21::segmented_vector::front Called on an empty vector");
+    return chunks_[0][0];
+  }
+
+  const_reference front() const noexcept {
+    S21_VECTOR_ASSERT(size_ != 0,
+                      "s21::segmented_vector::front Called on an empty vector");
+    return chunks_[0][0];
+  }
+
+  reference back() noexcept {
+    S21_VECTOR_ASSERT(size_ != 0,
+                      "s21::segmented_vector::back Called on an empty vector");
+    return (*this)[size_ - 1];
+  }
+
+  const_reference back() const noexcept {
+    S21_VECTOR_ASSERT(size_ != 0,
+                      "s21::segmented_vector::back Called on an empty vector");
+    return (*this)[size_ - 1];
+  }
+
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept {
+    return std::numeric_limits<difference_type>::max() / sizeof(value_type);
+  }
+
+  // Room in the allocated chunks
+  size_type capacity() const noexcept { return Chunks() * ChunkSize; }
+
+  // Allocates the chunks for count elements
+  void reserve(size_type count) {
+    if (count > max_size())
+      throw std::length_error(
+          "s21::segmented_vector::reserve Reserve capacity can't be larger "
+          "than max_size()");
+    size_type chunks = (count + ChunkSize - 1) >> kShift;
+    if (chunks > Chunks()) {
+      chunks_.reserve(chunks + 1);
+      while (Chunks() < chunks) AddChunk();
+    }
+  }
+
+  // Frees the chunks no element is in
+  void shrink_to_fit() {
+    size_type used = (size_ + ChunkSize - 1) >> kShift;
+    while (Chunks() > used) {
+      FreeChunk(chunks_[Chunks() - 1]);
+      chunks_.pop_back();
+      chunks_.back() = nullptr;
+    }
+    if (used == 0) {
+      chunks_.clear();
+    }
+    chunks_.shrink_to_fit();
+  }
+
+  // Destroys the elements, the chunks are kept
+  void clear() noexcept {
+    for_each_chunk([](T *first, T *last) { std::destroy(first, last); });
+    size_ = 0;
+  }
+
+  template <class... Args>
+  reference emplace_back(Args &&...args) {
+    if (size_ == capacity()) AddChunk();
+    T *slot = chunks_[size_ >> kShift] + (size_ & kMask);
+    ::new (static_cast<void *>(slot)) T(std::forward<Args>(args)...);
+    ++size_;
+    return *slot;
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  // Destroys the last element, its chunk is kept for the next push_back()
+  void pop_back() {
+    if (size_ == 0)
+      throw std::length_error(
+          "s21::segmented_vector::pop_back Calling pop_back() on an empty "
+          "container causes undefined behavior");
+    --size_;
+    std::destroy_at(chunks_[size_ >> kShift] + (size_ & kMask));
+  }
+
+  void swap(segmented_vector &other) noexcept {
+    chunks_.swap(other.chunks_);
+    std::swap(size_, other.size_);
+  }
+
+  size_type chunk_count() const noexcept {
+    return (size_ + ChunkSize - 1) >> kShift;
+  }
+
+  // Calls f(first, last) for the elements of every chunk in order, each
+  // [first, last) a contiguous array
+  template <class F>
+  void for_each_chunk(F &&f) {
+    for (size_type begin = 0; begin < size_; begin += ChunkSize) {
+      T *chunk = chunks_[begin >> kShift];
+      f(chunk, chunk + std::min(ChunkSize, size_ - begin));
+    }
+  }
+
+  template <class F>
+  void for_each_chunk(F &&f) const {
+    for (size_type begin = 0; begin < size_; begin += ChunkSize) {
+      const T *chunk = chunks_[begin >> kShift];
+      f(chunk, chunk + std::min(ChunkSize, size_ - begin));
+    }
+  }
+};
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_SEGMENTED_VECTOR_H
@@ -0,0 +1,354 @@
+#ifndef CONTAINERS_CPP_SERIALIZATION_H
+#define CONTAINERS_CPP_SERIALIZATION_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "vector.h"
+
+namespace s21 {
+
+// Binary serialization of s21::vector and its elements. A writer encodes
+// into a sink, a reader decodes from a source; both are any type with
+//
+//   void write(const void *data, std::size_t bytes);  // sink, all or throw
+//   std::size_t read(void *data, std::size_t bytes);  // source, 0 at end
+//
+// The encoding:
+//   trivially copyable T     sizeof(T) bytes of the object
+//   std::string              u64 length, then the characters
+//   s21::vector<T>           u64 size, then the elements; one bulk copy of
+//                            data() for trivially copyable T
+//   write_chunk()s           u64 count and count elements per chunk, a
+//                            zero count after the last one
+//
+// Integers, floating point numbers and enums, alone or as vector elements,
+// are stored in the byte order of the writer and swapped by a reader of
+// the other order. Other trivially copyable types are copied as they are.
+namespace serial {
+
+enum class byte_order {
+  little,
+  big,
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  native = big,
+#else
+  native = little,
+#endif
+};
+
+class error : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
+// Appends to a byte vector
+class memory_sink {
+ public:
+  explicit memory_sink(vector<unsigned char> &bytes) noexcept
+      : bytes_(bytes) {}
+
+  void write(const void *data, std::size_t bytes) {
+    // An empty array may come with a null data pointer, memcpy forbids it
+    if (!bytes) return;
+    const std::size_t size = bytes_.size();
+    bytes_.resize_and_overwrite(
+        size + bytes, [data, size, bytes](unsigned char *out, std::size_t) {
+          std::memcpy(out + size, data, bytes);
+          return size + bytes;
+        });
+  }
+
+ private:
+  vector<unsigned char> &bytes_;
+};
+
+// Reads from a block of memory, which has to outlive it
+class memory_source {
+ public:
+  memory_source(const void *data, std::size_t size) noexcept
+      : data_(static_cast<const unsigned char *>(data)), size_(size) {}
+
+  explicit memory_source(const vector<unsigned char> &bytes) noexcept
+      : memory_source(bytes.data(), bytes.size()) {}
+
+  std::size_t read(void *data, std::size_t bytes) noexcept {
+    bytes = std::min(bytes, size_ - offset_);
+    if (!bytes) return 0;
+    std::memcpy(data, data_ + offset_, bytes);
+    offset_ += bytes;
+    return bytes;
+  }
+
+  std::size_t remaining() const noexcept { return size_ - offset_; }
+
+ private:
+  const unsigned char *data_;
+  std::size_t size_;
+  std::size_t offset_ = 0;
+};
+
+// Writes to a stdio stream it doesn't own
+class file_sink {
+ public:
+  explicit file_sink(std::FILE *file) noexcept : file_(file) {}
+
+  void write(const void *data, std::size_t bytes) {
+    if (std::fwrite(data, 1, bytes, file_) != bytes)
+      throw error("s21::serial::file_sink::write Can't write to the file");
+  }
+
+ private:
+  std::FILE *file_;
+};
+
+// Reads from a stdio stream it doesn't own
+class file_source {
+ public:
+  explicit file_source(std::FILE *file) noexcept : file_(file) {}
+
+  std::size_t read(void *data, std::size_t bytes) {
+    std::size_t done = std::fread(data, 1, bytes, file_);
+    if (done < bytes && std::ferror(file_))
+      throw error("s21::serial::file_source::read Can't read the file");
+    return done;
+  }
+
+ private:
+  std::FILE *file_;
+};
+
+namespace detail {
+
+// Values whose bytes are swapped between byte orders
+template <class T>
+inline constexpr bool kSwappable =
+    (std::is_arithmetic_v<T> || std::is_enum_v<T>) && sizeof(T) > 1 &&
+    (sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+template <class T>
+void ByteSwap(T &value) noexcept {
+  if constexpr (sizeof(T) == 2) {
+    std::uint16_t bits;
+    std::memcpy(&bits, &value, 2);
+    bits = __builtin_bswap16(bits);
+    std::memcpy(&value, &bits, 2);
+  } else if constexpr (sizeof(T) == 4) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, 4);
+    bits = __builtin_bswap32(bits);
+    std::memcpy(&value, &bits, 4);
+  } else {
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, 8);
+    bits = __builtin_bswap64(bits);
+    std::memcpy(&value, &bits, 8);
+  }
+}
+
+// Bytes of the stack buffer swapped arrays are staged in
+inline constexpr std::size_t kSwapBuffer = 4096;
+
+}  // namespace detail
+
+template <class Sink>
+class writer {
+ public:
+  explicit writer(Sink &sink, byte_order order = byte_order::native) noexcept
+      : sink_(sink), swap_(order != byte_order::native) {}
+
+  Sink &sink() const noexcept { return sink_; }
+
+  template <class T,
+            std::enable_if_t<std::is_trivially_copyable_v<T>, int> = 0>
+  void write(const T &value) {
+    Array(&value, 1);
+  }
+
+  void write(const std::string &value) {
+    Size(value.size());
+    sink_.write(value.data(), value.size());
+  }
+
+  template <class T, class Allocator, class GrowthPolicy>
+  void write(const vector<T, Allocator, GrowthPolicy> &values) {
+    Size(values.size());
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      Array(values.data(), values.size());
+    } else {
+      for (const T &value : values) write(value);
+    }
+  }
+
+  // One chunk of a stream of unknown length, for read_chunks(). Empty
+  // chunks are skipped, the zero count is the end
+  template <class T>
+  void write_chunk(const T *data, std::size_t count) {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "s21::serial::writer::write_chunk T must be trivially "
+                  "copyable");
+    if (!count) return;
+    Size(count);
+    Array(data, count);
+  }
+
+  void end_chunks() { Size(0); }
+
+  // values as chunks of at most chunk elements and the end mark
+  template <class T, class Allocator, class GrowthPolicy>
+  void write_chunked(const vector<T, Allocator, GrowthPolicy> &values,
+                     std::size_t chunk) {
+    for (std::size_t begin = 0; begin < values.size(); begin += chunk)
+      write_chunk(values.data() + begin,
+                  std::min(chunk, values.size() - begin));
+    end_chunks();
+  }
+
+ private:
+  Sink &sink_;
+  bool swap_;
+
+  void Size(std::size_t size) { write(static_cast<std::uint64_t>(size)); }
+
+  template <class T>
+  void Array(const T *data, std::size_t count) {
+    if constexpr (detail::kSwappable<T>) {
+      if (swap_) {
+        constexpr std::size_t kStep = detail::kSwapBuffer / sizeof(T);
+        T buffer[kStep];
+        for (std::size_t begin = 0; begin < count; begin += kStep) {
+          std::size_t step = std::min(kStep, count - begin);
+          std::memcpy(buffer, data + begin, step * sizeof(T));
+          for (std::size_t i = 0; i < step; ++i) detail::ByteSwap(buffer[i]);
+          sink_.write(buffer, step * sizeof(T));
+        }
+        return;
+      }
+    }
+    sink_.write(data, count * sizeof(T));
+  }
+};
+
+template <class Source>
+class reader {
+ public:
+  // Elements filled in per step while a vector of announced size is read:
+  // a corrupt size runs out of input before it runs out of memory
+  static constexpr std::size_t kChunkBytes = std::size_t{1} << 20;
+
+  explicit reader(Source &source,
+                  byte_order order = byte_order::native) noexcept
+      : source_(source), swap_(order != byte_order::native) {}
+
+  Source &source() const noexcept { return source_; }
+
+  template <class T,
+            std::enable_if_t<std::is_trivially_copyable_v<T>, int> = 0>
+  void read(T &value) {
+    Array(&value, 1);
+  }
+
+  void read(std::string &value) {
+    std::size_t size = Size();
+    value.clear();
+    while (value.size() < size) {
+      std::size_t begin = value.size();
+      std::size_t step = std::min(size - begin, kChunkBytes);
+      value.resize(begin + step);
+      Bytes(&value[begin], step);
+    }
+  }
+
+  // Replaces the contents of values
+  template <class T, class Allocator, class GrowthPolicy>
+  void read(vector<T, Allocator, GrowthPolicy> &values) {
+    std::size_t size = Size();
+    values.clear();
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      Fill(values, size);
+    } else {
+      values.reserve(std::min(size, kChunkBytes / sizeof(T)));
+      for (std::size_t i = 0; i < size; ++i) {
+        T value;
+        read(value);
+        values.push_back(std::move(value));
+      }
+    }
+  }
+
+  template <class T>
+  T get() {
+    T value;
+    read(value);
+    return value;
+  }
+
+  // Appends the chunks up to the end mark to values, growing it once per
+  // chunk, or per kChunkBytes of a larger one
+  template <class T, class Allocator, class GrowthPolicy>
+  void read_chunks(vector<T, Allocator, GrowthPolicy> &values) {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "s21::serial::reader::read_chunks T must be trivially "
+                  "copyable");
+    while (std::size_t count = Size()) Fill(values, count);
+  }
+
+ private:
+  Source &source_;
+  bool swap_;
+
+  void Bytes(void *data, std::size_t bytes) {
+    auto *out = static_cast<unsigned char *>(data);
+    while (bytes) {
+      std::size_t done = source_.read(out, bytes);
+      if (!done)
+        throw error("s21::serial::reader Unexpected end of the stream");
+      out += done;
+      bytes -= done;
+    }
+  }
+
+  template <class T>
+  void Array(T *data, std::size_t count) {
+    Bytes(data, count * sizeof(T));
+    if constexpr (detail::kSwappable<T>) {
+      if (swap_)
+        for (std::size_t i = 0; i < count; ++i) detail::ByteSwap(data[i]);
+    }
+  }
+
+  std::size_t Size() {
+    std::uint64_t size = get<std::uint64_t>();
+    if (size > static_cast<std::uint64_t>(static_cast<std::size_t>(-1)))
+      throw error("s21::serial::reader The size doesn't fit size_t");
+    return static_cast<std::size_t>(size);
+  }
+
+  // Reads count elements into the end of values
+  template <class T, class Allocator, class GrowthPolicy>
+  void Fill(vector<T, Allocator, GrowthPolicy> &values, std::size_t count) {
+    constexpr std::size_t kStep = std::max<std::size_t>(
+        1, kChunkBytes / sizeof(T));
+    while (count) {
+      std::size_t step = std::min(count, kStep);
+      std::size_t size = values.size();
+      values.resize_and_overwrite(size + step, [&](T *data, std::size_t) {
+        Array(data + size, step);
+        return size + step;
+      });
+      count -= step;
+    }
+  }
+};
+
+}  // namespace serial
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_SERIALIZATION_H
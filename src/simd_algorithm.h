@@ -0,0 +1,733 @@
+#ifndef CONTAINERS_CPP_SIMD_ALGORITHM_H
+#define CONTAINERS_CPP_SIMD_ALGORITHM_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "hardening.h"
+#include "vector.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define S21_SIMD_X86 1
+#include <immintrin.h>
+#define S21_SIMD_SSE4 __attribute__((target("sse4.2,popcnt")))
+#define S21_SIMD_AVX2 __attribute__((target("avx2,popcnt")))
+#else
+#define S21_SIMD_X86 0
+#endif
+
+namespace s21 {
+
+// Linear scans over the int32_t, float and double elements of an
+// s21::vector: find, count, min, max, sum and a compacting filter. Each has
+// a scalar, an SSE4.2 and an AVX2 version, the widest one the CPU supports
+// is picked at run time, so the binary needs no -m flags. set_isa() narrows
+// the choice, e.g. to compare the versions.
+//
+// The results don't depend on the version, except for min and max over NaN
+// and the rounding of float and double sums, which add in a different order.
+namespace simd {
+
+enum class isa { scalar, sse4, avx2 };
+
+enum class compare {
+  less,
+  less_equal,
+  equal,
+  not_equal,
+  greater_equal,
+  greater
+};
+
+// sum() adds int32_t in 64 bits, floating point in the element type
+template <class T>
+using sum_type = std::conditional_t<std::is_integral_v<T>, std::int64_t, T>;
+
+namespace detail {
+
+template <class T>
+constexpr bool kSupported = std::is_same_v<T, std::int32_t> ||
+                            std::is_same_v<T, float> ||
+                            std::is_same_v<T, double>;
+
+// Elements the filters may write past their result, one register
+constexpr std::size_t kSlack = 8;
+
+inline isa Detect() noexcept {
+#if S21_SIMD_X86
+  __builtin_cpu_init();
+  if (!__builtin_cpu_supports("popcnt")) return isa::scalar;
+  if (__builtin_cpu_supports("avx2")) return isa::avx2;
+  if (__builtin_cpu_supports("sse4.2")) return isa::sse4;
+#endif
+  return isa::scalar;
+}
+
+}  // namespace detail
+
+// The widest instruction set of this CPU the algorithms have a version for
+inline isa detected_isa() noexcept {
+  static const isa level = detail::Detect();
+  return level;
+}
+
+namespace detail {
+
+inline std::atomic<isa> &Active() noexcept {
+  static std::atomic<isa> level{detected_isa()};
+  return level;
+}
+
+}  // namespace detail
+
+inline isa active_isa() noexcept {
+  return detail::Active().load(std::memory_order_relaxed);
+}
+
+// Uses level, or detected_isa() if the CPU lacks it. Returns the level used
+inline isa set_isa(isa level) noexcept {
+  if (level > detected_isa()) level = detected_isa();
+  detail::Active().store(level, std::memory_order_relaxed);
+  return level;
+}
+
+inline const char *isa_name(isa level) noexcept {
+  switch (level) {
+    case isa::avx2:
+      return "avx2";
+    case isa::sse4:
+      return "sse4";
+    default:
+      return "scalar";
+  }
+}
+
+namespace detail {
+
+template <compare C, class T>
+constexpr bool Matches(T x, T value) noexcept {
+  if constexpr (C == compare::less) {
+    return x < value;
+  } else if constexpr (C == compare::less_equal) {
+    return x <= value;
+  } else if constexpr (C == compare::equal) {
+    return x == value;
+  } else if constexpr (C == compare::not_equal) {
+    return x != value;
+  } else if constexpr (C == compare::greater_equal) {
+    return x >= value;
+  } else {
+    return x > value;
+  }
+}
+
+namespace scalar {
+
+template <class T>
+std::size_t Find(const T *data, std::size_t size, T value) noexcept {
+  for (std::size_t i = 0; i < size; ++i)
+    if (data[i] == value) return i;
+  return size;
+}
+
+template <class T>
+std::size_t Count(const T *data, std::size_t size, T value) noexcept {
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < size; ++i) count += data[i] == value;
+  return count;
+}
+
+template <bool kMax, class T>
+T Extreme(const T *data, std::size_t size) noexcept {
+  T result = data[0];
+  for (std::size_t i = 1; i < size; ++i) {
+    if constexpr (kMax) {
+      result = result < data[i] ? data[i] : result;
+    } else {
+      result = data[i] < result ? data[i] : result;
+    }
+  }
+  return result;
+}
+
+template <class T>
+sum_type<T> Sum(const T *data, std::size_t size) noexcept {
+  sum_type<T> sum = 0;
+  for (std::size_t i = 0; i < size; ++i) sum += data[i];
+  return sum;
+}
+
+// Writes every element and advances past the matching ones, so there is no
+// branch to mispredict; writes one element past the result
+template <compare C, class T>
+std::size_t Filter(const T *data, std::size_t size, T value,
+                   T *out) noexcept {
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < size; ++i) {
+    out[count] = data[i];
+    count += Matches<C>(data[i], value);
+  }
+  return count;
+}
+
+}  // namespace scalar
+
+#if S21_SIMD_X86
+
+// Entry m lists the units (bytes or 32 bit words) of the lanes set in m, in
+// order: shuffling a register with it packs the selected lanes to the front
+template <std::size_t kLanes, std::size_t kWidth>
+constexpr auto CompressTable() {
+  std::array<std::array<std::uint8_t, kLanes * kWidth>, (1u << kLanes)>
+      table{};
+  for (std::size_t mask = 0; mask < table.size(); ++mask) {
+    std::size_t unit = 0;
+    for (std::size_t lane = 0; lane < kLanes; ++lane)
+      if (mask >> lane & 1)
+        for (std::size_t part = 0; part < kWidth; ++part)
+          table[mask][unit++] = static_cast<std::uint8_t>(lane * kWidth + part);
+  }
+  return table;
+}
+
+template <std::size_t kLanes, std::size_t kWidth>
+inline constexpr auto kCompressTable = CompressTable<kLanes, kWidth>();
+
+// Register operations per element type. Mask<C>(a, b) has bit i set when
+// lane i of a compares C to lane i of b, Compress() stores the lanes
+// selected by mask to the front of out and garbage after them
+namespace sse4 {
+
+template <class T>
+struct Ops;
+
+template <>
+struct Ops<std::int32_t> {
+  using reg = __m128i;
+  using acc = __m128i;
+  static constexpr std::size_t kLanes = 4;
+
+  S21_SIMD_SSE4 static reg Load(const std::int32_t *p) noexcept {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+  }
+  S21_SIMD_SSE4 static void Store(std::int32_t *p, reg v) noexcept {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v);
+  }
+  S21_SIMD_SSE4 static reg Set1(std::int32_t value) noexcept {
+    return _mm_set1_epi32(value);
+  }
+  S21_SIMD_SSE4 static unsigned Bits(reg v) noexcept {
+    return _mm_movemask_ps(_mm_castsi128_ps(v));
+  }
+  template <compare C>
+  S21_SIMD_SSE4 static unsigned Mask(reg a, reg b) noexcept {
+    if constexpr (C == compare::less) {
+      return Bits(_mm_cmpgt_epi32(b, a));
+    } else if constexpr (C == compare::less_equal) {
+      return Bits(_mm_cmpgt_epi32(a, b)) ^ 0xF;
+    } else if constexpr (C == compare::equal) {
+      return Bits(_mm_cmpeq_epi32(a, b));
+    } else if constexpr (C == compare::not_equal) {
+      return Bits(_mm_cmpeq_epi32(a, b)) ^ 0xF;
+    } else if constexpr (C == compare::greater_equal) {
+      return Bits(_mm_cmpgt_epi32(b, a)) ^ 0xF;
+    } else {
+      return Bits(_mm_cmpgt_epi32(a, b));
+    }
+  }
+  S21_SIMD_SSE4 static reg Min(reg a, reg b) noexcept {
+    return _mm_min_epi32(a, b);
+  }
+  S21_SIMD_SSE4 static reg Max(reg a, reg b) noexcept {
+    return _mm_max_epi32(a, b);
+  }
+  S21_SIMD_SSE4 static acc Zero() noexcept { return _mm_setzero_si128(); }
+  // Widens the lanes to 64 bits before adding
+  S21_SIMD_SSE4 static acc Add(acc sum, reg v) noexcept {
+    sum = _mm_add_epi64(sum, _mm_cvtepi32_epi64(v));
+    return _mm_add_epi64(sum, _mm_cvtepi32_epi64(_mm_srli_si128(v, 8)));
+  }
+  S21_SIMD_SSE4 static std::int64_t Reduce(acc sum) noexcept {
+    return _mm_cvtsi128_si64(sum) + _mm_extract_epi64(sum, 1);
+  }
+  S21_SIMD_SSE4 static void Compress(std::int32_t *out, reg v,
+                                     unsigned mask) noexcept {
+    reg shuffle = _mm_loadu_si128(
+        reinterpret_cast<const __m128i *>(kCompressTable<4, 4>[mask].data()));
+    Store(out, _mm_shuffle_epi8(v, shuffle));
+  }
+};
+
+template <>
+struct Ops<float> {
+  using reg = __m128;
+  using acc = __m128;
+  static constexpr std::size_t kLanes = 4;
+
+  S21_SIMD_SSE4 static reg Load(const float *p) noexcept {
+    return _mm_loadu_ps(p);
+  }
+  S21_SIMD_SSE4 static void Store(float *p, reg v) noexcept {
+    _mm_storeu_ps(p, v);
+  }
+  S21_SIMD_SSE4 static reg Set1(float value) noexcept {
+    return _mm_set1_ps(value);
+  }
+  template <compare C>
+  S21_SIMD_SSE4 static unsigned Mask(reg a, reg b) noexcept {
+    if constexpr (C == compare::less) {
+      return _mm_movemask_ps(_mm_cmplt_ps(a, b));
+    } else if constexpr (C == compare::less_equal) {
+      return _mm_movemask_ps(_mm_cmple_ps(a, b));
+    } else if constexpr (C == compare::equal) {
+      return _mm_movemask_ps(_mm_cmpeq_ps(a, b));
+    } else if constexpr (C == compare::not_equal) {
+      return _mm_movemask_ps(_mm_cmpneq_ps(a, b));
+    } else if constexpr (C == compare::greater_equal) {
+      return _mm_movemask_ps(_mm_cmpge_ps(a, b));
+    } else {
+      return _mm_movemask_ps(_mm_cmpgt_ps(a, b));
+    }
+  }
+  S21_SIMD_SSE4 static reg Min(reg a, reg b) noexcept {
+    return _mm_min_ps(a, b);
+  }
+  S21_SIMD_SSE4 static reg Max(reg a, reg b) noexcept {
+    return _mm_max_ps(a, b);
+  }
+  S21_SIMD_SSE4 static acc Zero() noexcept { return _mm_setzero_ps(); }
+  S21_SIMD_SSE4 static acc Add(acc sum, reg v) noexcept {
+    return _mm_add_ps(sum, v);
+  }
+  S21_SIMD_SSE4 static float Reduce(acc sum) noexcept {
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+    return _mm_cvtss_f32(sum);
+  }
+  S21_SIMD_SSE4 static void Compress(float *out, reg v,
+                                     unsigned mask) noexcept {
+    __m128i shuffle = _mm_loadu_si128(
+        reinterpret_cast<const __m128i *>(kCompressTable<4, 4>[mask].data()));
+    Store(out,
+          _mm_castsi128_ps(_mm_shuffle_epi8(_mm_castps_si128(v), shuffle)));
+  }
+};
+
+template <>
+struct Ops<double> {
+  using reg = __m128d;
+  using acc = __m128d;
+  static constexpr std::size_t kLanes = 2;
+
+  S21_SIMD_SSE4 static reg Load(const double *p) noexcept {
+    return _mm_loadu_pd(p);
+  }
+  S21_SIMD_SSE4 static void Store(double *p, reg v) noexcept {
+    _mm_storeu_pd(p, v);
+  }
+  S21_SIMD_SSE4 static reg Set1(double value) noexcept {
+    return _mm_set1_pd(value);
+  }
+  template <compare C>
+  S21_SIMD_SSE4 static unsigned Mask(reg a, reg b) noexcept {
+    if constexpr (C == compare::less) {
+      return _mm_movemask_pd(_mm_cmplt_pd(a, b));
+    } else if constexpr (C == compare::less_equal) {
+      return _mm_movemask_pd(_mm_cmple_pd(a, b));
+    } else if constexpr (C == compare::equal) {
+      return _mm_movemask_pd(_mm_cmpeq_pd(a, b));
+    } else if constexpr (C == compare::not_equal) {
+      return _mm_movemask_pd(_mm_cmpneq_pd(a, b));
+    } else if constexpr (C == compare::greater_equal) {
+      return _mm_movemask_pd(_mm_cmpge_pd(a, b));
+    } else {
+      return _mm_movemask_pd(_mm_cmpgt_pd(a, b));
+    }
+  }
+  S21_SIMD_SSE4 static reg Min(reg a, reg b) noexcept {
+    return _mm_min_pd(a, b);
+  }
+  S21_SIMD_SSE4 static reg Max(reg a, reg b) noexcept {
+    return _mm_max_pd(a, b);
+  }
+  S21_SIMD_SSE4 static acc Zero() noexcept { return _mm_setzero_pd(); }
+  S21_SIMD_SSE4 static acc Add(acc sum, reg v) noexcept {
+    return _mm_add_pd(sum, v);
+  }
+  S21_SIMD_SSE4 static double Reduce(acc sum) noexcept {
+    return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+  }
+  S21_SIMD_SSE4 static void Compress(double *out, reg v,
+                                     unsigned mask) noexcept {
+    __m128i shuffle = _mm_loadu_si128(
+        reinterpret_cast<const __m128i *>(kCompressTable<2, 8>[mask].data()));
+    Store(out,
+          _mm_castsi128_pd(_mm_shuffle_epi8(_mm_castpd_si128(v), shuffle)));
+  }
+};
+
+#define S21_SIMD_TARGET S21_SIMD_SSE4
+#include "simd_kernels.inc"
+#undef S21_SIMD_TARGET
+
+}  // namespace sse4
+
+namespace avx2 {
+
+template <class T>
+struct Ops;
+
+// Index vector for _mm256_permutevar8x32 from a row of kCompressTable
+S21_SIMD_AVX2 inline __m256i PermuteIndex(const std::uint8_t *row) noexcept {
+  return _mm256_cvtepu8_epi32(
+      _mm_loadl_epi64(reinterpret_cast<const __m128i *>(row)));
+}
+
+template <>
+struct Ops<std::int32_t> {
+  using reg = __m256i;
+  using acc = __m256i;
+  static constexpr std::size_t kLanes = 8;
+
+  S21_SIMD_AVX2 static reg Load(const std::int32_t *p) noexcept {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+  }
+  S21_SIMD_AVX2 static void Store(std::int32_t *p, reg v) noexcept {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v);
+  }
+  S21_SIMD_AVX2 static reg Set1(std::int32_t value) noexcept {
+    return _mm256_set1_epi32(value);
+  }
+  S21_SIMD_AVX2 static unsigned Bits(reg v) noexcept {
+    return _mm256_movemask_ps(_mm256_castsi256_ps(v));
+  }
+  template <compare C>
+  S21_SIMD_AVX2 static unsigned Mask(reg a, reg b) noexcept {
+    if constexpr (C == compare::less) {
+      return Bits(_mm256_cmpgt_epi32(b, a));
+    } else if constexpr (C == compare::less_equal) {
+      return Bits(_mm256_cmpgt_epi32(a, b)) ^ 0xFF;
+    } else if constexpr (C == compare::equal) {
+      return Bits(_mm256_cmpeq_epi32(a, b));
+    } else if constexpr (C == compare::not_equal) {
+      return Bits(_mm256_cmpeq_epi32(a, b)) ^ 0xFF;
+    } else if constexpr (C == compare::greater_equal) {
+      return Bits(_mm256_cmpgt_epi32(b, a)) ^ 0xFF;
+    } else {
+      return Bits(_mm256_cmpgt_epi32(a, b));
+    }
+  }
+  S21_SIMD_AVX2 static reg Min(reg a, reg b) noexcept {
+    return _mm256_min_epi32(a, b);
+  }
+  S21_SIMD_AVX2 static reg Max(reg a, reg b) noexcept {
+    return _mm256_max_epi32(a, b);
+  }
+  S21_SIMD_AVX2 static acc Zero() noexcept { return _mm256_setzero_si256(); }
+  // Widens the lanes to 64 bits before adding
+  S21_SIMD_AVX2 static acc Add(acc sum, reg v) noexcept {
+    sum = _mm256_add_epi64(sum,
+                           _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+    return _mm256_add_epi64(
+        sum, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+  }
+  S21_SIMD_AVX2 static std::int64_t Reduce(acc sum) noexcept {
+    __m128i half = _mm_add_epi64(_mm256_castsi256_si128(sum),
+                                 _mm256_extracti128_si256(sum, 1));
+    return _mm_cvtsi128_si64(half) + _mm_extract_epi64(half, 1);
+  }
+  S21_SIMD_AVX2 static void Compress(std::int32_t *out, reg v,
+                                     unsigned mask) noexcept {
+    Store(out, _mm256_permutevar8x32_epi32(
+                   v, PermuteIndex(kCompressTable<8, 1>[mask].data())));
+  }
+};
+
+template <>
+struct Ops<float> {
+  using reg = __m256;
+  using acc = __m256;
+  static constexpr std::size_t kLanes = 8;
+
+  S21_SIMD_AVX2 static reg Load(const float *p) noexcept {
+    return _mm256_loadu_ps(p);
+  }
+  S21_SIMD_AVX2 static void Store(float *p, reg v) noexcept {
+    _mm256_storeu_ps(p, v);
+  }
+  S21_SIMD_AVX2 static reg Set1(float value) noexcept {
+    return _mm256_set1_ps(value);
+  }
+  template <compare C>
+  S21_SIMD_AVX2 static unsigned Mask(reg a, reg b) noexcept {
+    if constexpr (C == compare::less) {
+      return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LT_OQ));
+    } else if constexpr (C == compare::less_equal) {
+      return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LE_OQ));
+    } else if constexpr (C == compare::equal) {
+      return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ));
+    } else if constexpr (C == compare::not_equal) {
+      return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_NEQ_UQ));
+    } else if constexpr (C == compare::greater_equal) {
+      return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_GE_OQ));
+    } else {
+      return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_GT_OQ));
+    }
+  }
+  S21_SIMD_AVX2 static reg Min(reg a, reg b) noexcept {
+    return _mm256_min_ps(a, b);
+  }
+  S21_SIMD_AVX2 static reg Max(reg a, reg b) noexcept {
+    return _mm256_max_ps(a, b);
+  }
+  S21_SIMD_AVX2 static acc Zero() noexcept { return _mm256_setzero_ps(); }
+  S21_SIMD_AVX2 static acc Add(acc sum, reg v) noexcept {
+    return _mm256_add_ps(sum, v);
+  }
+  S21_SIMD_AVX2 static float Reduce(acc sum) noexcept {
+    __m128 half = _mm_add_ps(_mm256_castps256_ps128(sum),
+                             _mm256_extractf128_ps(sum, 1));
+    half = _mm_add_ps(half, _mm_movehl_ps(half, half));
+    half = _mm_add_ss(half, _mm_shuffle_ps(half, half, 1));
+    return _mm_cvtss_f32(half);
+  }
+  S21_SIMD_AVX2 static void Compress(float *out, reg v,
+                                     unsigned mask) noexcept {
+    Store(out, _mm256_permutevar8x32_ps(
+                   v, PermuteIndex(kCompressTable<8, 1>[mask].data())));
+  }
+};
+
+template <>
+struct Ops<double> {
+  using reg = __m256d;
+  using acc = __m256d;
+  static constexpr std::size_t kLanes = 4;
+
+  S21_SIMD_AVX2 static reg Load(const double *p) noexcept {
+    return _mm256_loadu_pd(p);
+  }
+  S21_SIMD_AVX2 static void Store(double *p, reg v) noexcept {
+    _mm256_storeu_pd(p, v);
+  }
+  S21_SIMD_AVX2 static reg Set1(double value) noexcept {
+    return _mm256_set1_pd(value);
+  }
+  template <compare C>
+  S21_SIMD_AVX2 static unsigned Mask(reg a, reg b) noexcept {
+    if constexpr (C == compare::less) {
+      return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_LT_OQ));
+    } else if constexpr (C == compare::less_equal) {
+      return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_LE_OQ));
+    } else if constexpr (C == compare::equal) {
+      return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ));
+    } else if constexpr (C == compare::not_equal) {
+      return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_NEQ_UQ));
+    } else if constexpr (C == compare::greater_equal) {
+      return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_GE_OQ));
+    } else {
+      return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_GT_OQ));
+    }
+  }
+  S21_SIMD_AVX2 static reg Min(reg a, reg b) noexcept {
+    return _mm256_min_pd(a, b);
+  }
+  S21_SIMD_AVX2 static reg Max(reg a, reg b) noexcept {
+    return _mm256_max_pd(a, b);
+  }
+  S21_SIMD_AVX2 static acc Zero() noexcept { return _mm256_setzero_pd(); }
+  S21_SIMD_AVX2 static acc Add(acc sum, reg v) noexcept {
+    return _mm256_add_pd(sum, v);
+  }
+  S21_SIMD_AVX2 static double Reduce(acc sum) noexcept {
+    __m128d half = _mm_add_pd(_mm256_castpd256_pd128(sum),
+                              _mm256_extractf128_pd(sum, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(half, _mm_unpackhi_pd(half, half)));
+  }
+  // A double is two 32 bit words of the permutation
+  S21_SIMD_AVX2 static void Compress(double *out, reg v,
+                                     unsigned mask) noexcept {
+    __m256 words = _mm256_permutevar8x32_ps(
+        _mm256_castpd_ps(v), PermuteIndex(kCompressTable<4, 2>[mask].data()));
+    Store(out, _mm256_castps_pd(words));
+  }
+};
+
+#define S21_SIMD_TARGET S21_SIMD_AVX2
+#include "simd_kernels.inc"
+#undef S21_SIMD_TARGET
+
+}  // namespace avx2
+
+#endif  // S21_SIMD_X86
+
+// The dispatchers, one switch per call
+template <class T>
+std::size_t Find(const T *data, std::size_t size, T value) noexcept {
+  switch (active_isa()) {
+#if S21_SIMD_X86
+    case isa::avx2:
+      return avx2::Find(data, size, value);
+    case isa::sse4:
+      return sse4::Find(data, size, value);
+#endif
+    default:
+      return scalar::Find(data, size, value);
+  }
+}
+
+template <class T>
+std::size_t Count(const T *data, std::size_t size, T value) noexcept {
+  switch (active_isa()) {
+#if S21_SIMD_X86
+    case isa::avx2:
+      return avx2::Count(data, size, value);
+    case isa::sse4:
+      return sse4::Count(data, size, value);
+#endif
+    default:
+      return scalar::Count(data, size, value);
+  }
+}
+
+template <bool kMax, class T>
+T Extreme(const T *data, std::size_t size) noexcept {
+  switch (active_isa()) {
+#if S21_SIMD_X86
+    case isa::avx2:
+      return avx2::Extreme<kMax>(data, size);
+    case isa::sse4:
+      return sse4::Extreme<kMax>(data, size);
+#endif
+    default:
+      return scalar::Extreme<kMax>(data, size);
+  }
+}
+
+template <class T>
+sum_type<T> Sum(const T *data, std::size_t size) noexcept {
+  switch (active_isa()) {
+#if S21_SIMD_X86
+    case isa::avx2:
+      return avx2::Sum(data, size);
+    case isa::sse4:
+      return sse4::Sum(data, size);
+#endif
+    default:
+      return scalar::Sum(data, size);
+  }
+}
+
+template <compare C, class T>
+std::size_t Filter(const T *data, std::size_t size, T value,
+                   T *out) noexcept {
+  switch (active_isa()) {
+#if S21_SIMD_X86
+    case isa::avx2:
+      return avx2::Filter<C>(data, size, value, out);
+    case isa::sse4:
+      return sse4::Filter<C>(data, size, value, out);
+#endif
+    default:
+      return scalar::Filter<C>(data, size, value, out);
+  }
+}
+
+template <class T>
+std::size_t Filter(const T *data, std::size_t size, compare predicate,
+                   T value, T *out) noexcept {
+  switch (predicate) {
+    case compare::less:
+      return Filter<compare::less>(data, size, value, out);
+    case compare::less_equal:
+      return Filter<compare::less_equal>(data, size, value, out);
+    case compare::equal:
+      return Filter<compare::equal>(data, size, value, out);
+    case compare::not_equal:
+      return Filter<compare::not_equal>(data, size, value, out);
+    case compare::greater_equal:
+      return Filter<compare::greater_equal>(data, size, value, out);
+    default:
+      return Filter<compare::greater>(data, size, value, out);
+  }
+}
+
+}  // namespace detail
+
+// First element equal to value, or end()
+template <class T, class Allocator, class GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::const_iterator find(
+    const vector<T, Allocator, GrowthPolicy> &vec,
+    typename vector<T, Allocator, GrowthPolicy>::value_type value) noexcept {
+  static_assert(detail::kSupported<T>,
+                "s21::simd::find T must be int32_t, float or double");
+  return vec.data() + detail::Find(vec.data(), vec.size(), value);
+}
+
+template <class T, class Allocator, class GrowthPolicy>
+std::size_t count(
+    const vector<T, Allocator, GrowthPolicy> &vec,
+    typename vector<T, Allocator, GrowthPolicy>::value_type value) noexcept {
+  static_assert(detail::kSupported<T>,
+                "s21::simd::count T must be int32_t, float or double");
+  return detail::Count(vec.data(), vec.size(), value);
+}
+
+// Smallest element, vec must not be empty
+template <class T, class Allocator, class GrowthPolicy>
+T min(const vector<T, Allocator, GrowthPolicy> &vec) noexcept {
+  static_assert(detail::kSupported<T>,
+                "s21::simd::min T must be int32_t, float or double");
+  S21_VECTOR_ASSERT(!vec.empty(), "s21::simd::min Called on an empty vector");
+  return detail::Extreme<false>(vec.data(), vec.size());
+}
+
+// Largest element, vec must not be empty
+template <class T, class Allocator, class GrowthPolicy>
+T max(const vector<T, Allocator, GrowthPolicy> &vec) noexcept {
+  static_assert(detail::kSupported<T>,
+                "s21::simd::max T must be int32_t, float or double");
+  S21_VECTOR_ASSERT(!vec.empty(), "s21::simd::max Called on an empty vector");
+  return detail::Extreme<true>(vec.data(), vec.size());
+}
+
+template <class T, class Allocator, class GrowthPolicy>
+sum_type<T> sum(const vector<T, Allocator, GrowthPolicy> &vec) noexcept {
+  static_assert(detail::kSupported<T>,
+                "s21::simd::sum T must be int32_t, float or double");
+  return detail::Sum(vec.data(), vec.size());
+}
+
+// Appends the elements x of vec with "x predicate value" to out, in order,
+// and returns their number. The loop has no data dependent branch: every
+// element is written and the output only advances past the matching ones.
+// out may end up with a few elements more capacity than that needs.
+template <class T, class Allocator, class GrowthPolicy, class OutAllocator,
+          class OutGrowthPolicy>
+std::size_t filter(
+    const vector<T, Allocator, GrowthPolicy> &vec, compare predicate,
+    typename vector<T, Allocator, GrowthPolicy>::value_type value,
+    vector<T, OutAllocator, OutGrowthPolicy> &out) {
+  static_assert(detail::kSupported<T>,
+                "s21::simd::filter T must be int32_t, float or double");
+  S21_VECTOR_ASSERT(static_cast<const void *>(&vec) != &out,
+                    "s21::simd::filter out must not be the input vector");
+  const std::size_t old_size = out.size();
+  std::size_t appended = 0;
+  out.resize_and_overwrite(
+      old_size + vec.size() + detail::kSlack,
+      [&](T *data, std::size_t) {
+        appended = detail::Filter(vec.data(), vec.size(), predicate, value,
+                                  data + old_size);
+        return old_size + appended;
+      });
+  return appended;
+}
+
+}  // namespace simd
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_SIMD_ALGORITHM_H
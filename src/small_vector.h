@@ -0,0 +1,416 @@
+#ifndef CONTAINERS_CPP_SMALL_VECTOR_H
+#define CONTAINERS_CPP_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "hardening.h"
+#include "trivially_relocatable.h"
+
+namespace s21 {
+
+// Vector keeping up to N elements inside the object itself, the heap is
+// only touched once the size grows beyond N
+template <class T, std::size_t N = 8>
+class small_vector {
+  static_assert(N > 0, "s21::small_vector Inline capacity must be positive");
+
+ public:
+  // Member types
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = std::size_t;
+
+ private:
+  size_type size_ = 0;
+  size_type capacity_ = N;
+  iterator array_ = Inline();
+  alignas(value_type) std::byte inline_[N * sizeof(value_type)];
+
+  iterator Inline() noexcept { return reinterpret_cast<iterator>(inline_); }
+
+  bool IsInline() const noexcept {
+    return array_ == reinterpret_cast<const_iterator>(inline_);
+  }
+
+  static iterator Allocate(size_type count) {
+    return std::allocator<value_type>().allocate(count);
+  }
+
+  void FreeHeap() noexcept {
+    if (!IsInline()) std::allocator<value_type>().deallocate(array_, capacity_);
+  }
+  // Moves [first, last) into raw storage and destroys the source elements
+  static void Relocate(iterator first, iterator last, iterator dest) {
+    if constexpr (is_trivially_relocatable_v<value_type>) {
+      if (first != last)
+        std::memcpy(static_cast<void *>(dest), first,
+                    (last - first) * sizeof(value_type));
+    } else {
+      if constexpr (std::is_nothrow_move_constructible_v<value_type> ||
+                    !std::is_copy_constructible_v<value_type>) {
+        std::uninitialized_move(first, last, dest);
+      } else {
+        std::uninitialized_copy(first, last, dest);
+      }
+      std::destroy(first, last);
+    }
+  }
+  // Helper function to reallocate memory, capacities up to N go back to
+  // the inline buffer
+  void ReallocVec(size_type new_capacity_) {
+    iterator tmp = new_capacity_ <= N ? Inline() : Allocate(new_capacity_);
+    if (tmp == array_) return;
+    try {
+      Relocate(array_, array_ + size_, tmp);
+    } catch (...) {
+      if (tmp != Inline())
+        std::allocator<value_type>().deallocate(tmp, new_capacity_);
+      throw;
+    }
+    FreeHeap();
+    array_ = tmp;
+    capacity_ = std::max(new_capacity_, N);
+  }
+
+  void GrowIfFull() {
+    if (size_ == capacity_) reserve(size_ * 2);
+  }
+
+  void InsertAt(size_type pos, value_type &&value) {
+    if constexpr (is_trivially_relocatable_v<value_type>) {
+      std::memmove(static_cast<void *>(array_ + pos + 1), array_ + pos,
+                   (size_ - pos) * sizeof(value_type));
+      try {
+        ::new (static_cast<void *>(array_ + pos)) value_type(std::move(value));
+      } catch (...) {
+        std::memmove(static_cast<void *>(array_ + pos), array_ + pos + 1,
+                     (size_ - pos) * sizeof(value_type));
+        throw;
+      }
+    } else if (pos == size_) {
+      ::new (static_cast<void *>(end())) value_type(std::move(value));
+    } else {
+      ::new (static_cast<void *>(end())) value_type(std::move(*(end() - 1)));
+      std::move_backward(begin() + pos, end() - 1, end());
+      array_[pos] = std::move(value);
+    }
+    ++size_;
+  }
+  // Takes over the elements of other, leaving it empty and inline
+  void Steal(small_vector &other) {
+    if (other.IsInline()) {
+      Relocate(other.begin(), other.end(), array_);
+    } else {
+      array_ = std::exchange(other.array_, other.Inline());
+      capacity_ = std::exchange(other.capacity_, N);
+    }
+    size_ = std::exchange(other.size_, 0);
+  }
+
+ public:
+  // Constructors
+  small_vector() noexcept {}
+
+  explicit small_vector(size_type size) {
+    reserve(size);
+    try {
+      std::uninitialized_value_construct_n(array_, size);
+    } catch (...) {
+      FreeHeap();
+      throw;
+    }
+    size_ = size;
+  }
+
+  small_vector(std::initializer_list<value_type> const &init) {
+    reserve(init.size());
+    try {
+      std::uninitialized_copy(init.begin(), init.end(), array_);
+    } catch (...) {
+      FreeHeap();
+      throw;
+    }
+    size_ = init.size();
+  }
+
+  small_vector(const small_vector &vec) {
+    reserve(vec.size_);
+    try {
+      std::uninitialized_copy(vec.begin(), vec.end(), array_);
+    } catch (...) {
+      FreeHeap();
+      throw;
+    }
+    size_ = vec.size_;
+  }
+
+  small_vector(small_vector &&vec) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>) {
+    Steal(vec);
+  }
+  // Destructor
+  ~small_vector() {
+    std::destroy(begin(), end());
+    FreeHeap();
+  }
+  // Move assignment operator
+  small_vector &operator=(small_vector &&vec) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>) {
+    if (this != &vec) {
+      clear();
+      if (!vec.IsInline()) {
+        FreeHeap();
+        array_ = Inline();
+        capacity_ = N;
+      }
+      Steal(vec);
+    }
+    return *this;
+  }
+  // Copy assignment operator
+  small_vector &operator=(const small_vector &vec) {
+    if (this != &vec) {
+      small_vector tmp(vec);
+      *this = std::move(tmp);
+    }
+    return *this;
+  }
+
+  constexpr iterator begin() noexcept { return array_; }
+
+  constexpr const_iterator begin() const noexcept { return array_; }
+
+  constexpr iterator end() noexcept { return array_ + size_; }
+
+  constexpr const_iterator end() const noexcept { return array_ + size_; }
+
+  reference at(size_type pos) {
+    if (pos >= size_)
+      throw std::out_of_range(
+          "s21::small_vector::at The index is out of range");
+
+    return array_[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size_)
+      throw std::out_of_range(
+          "s21::small_vector::at The index is out of range");
+
+    return array_[pos];
+  }
+
+  // Unchecked, see hardening.h for the debug/hardened precondition check
+  reference operator[](size_type pos) noexcept {
+    S21_VECTOR_ASSERT(pos < size_,
+                      "s21::small_vector::operator[] The index is out of "
+                      "range");
+    return array_[pos];
+  }
+
+  const_reference operator[](size_type pos) const noexcept {
+    S21_VECTOR_ASSERT(pos < size_,
+                      "s21::small_vector::operator[] The index is out of "
+                      "range");
+    return array_[pos];
+  }
+
+  reference front() noexcept {
+    S21_VECTOR_ASSERT(size_,
+                      "s21::small_vector::front Called on an empty container");
+    return array_[0];
+  }
+
+  const_reference front() const noexcept {
+    S21_VECTOR_ASSERT(size_,
+                      "s21::small_vector::front Called on an empty container");
+    return array_[0];
+  }
+
+  reference back() noexcept {
+    S21_VECTOR_ASSERT(size_,
+                      "s21::small_vector::back Called on an empty container");
+    return array_[size_ - 1];
+  }
+
+  const_reference back() const noexcept {
+    S21_VECTOR_ASSERT(size_,
+                      "s21::small_vector::back Called on an empty container");
+    return array_[size_ - 1];
+  }
+
+  constexpr iterator data() noexcept { return array_; }
+
+  constexpr const_iterator data() const noexcept { return array_; }
+
+  [[nodiscard]] bool empty() const noexcept { return !size_; }
+
+  [[nodiscard]] constexpr size_type size() const noexcept { return size_; }
+
+  [[nodiscard]] constexpr size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+  }
+
+  void reserve(size_type new_capacity_) {
+    if (new_capacity_ <= capacity_) return;
+
+    if (new_capacity_ > max_size())
+      throw std::length_error(
+          "s21::small_vector::reserve Reserve capacity can't be larger than "
+          "small_vector<T, N>::max_size()");
+
+    ReallocVec(new_capacity_);
+  }
+
+  constexpr size_type capacity() const noexcept { return capacity_; }
+
+  [[nodiscard]] constexpr size_type inline_capacity() const noexcept {
+    return N;
+  }
+  // True while the elements live inside the object
+  [[nodiscard]] bool is_inline() const noexcept { return IsInline(); }
+
+  void shrink_to_fit() {
+    if (IsInline() || capacity_ == size_) return;
+
+    ReallocVec(size_);
+  }
+
+  void clear() noexcept {
+    std::destroy(begin(), end());
+    size_ = 0;
+  }
+
+  iterator insert(const_iterator pos, value_type &&value) {
+    size_type tmp = pos - begin();
+    if (tmp > size_)
+      throw std::out_of_range(
+          "s21::small_vector::insert Unable to insert into a position out of "
+          "range of begin() to end()");
+
+    GrowIfFull();
+    InsertAt(tmp, std::move(value));
+    return begin() + tmp;
+  }
+
+  iterator insert(const_iterator pos, const_reference value) {
+    size_type tmp = pos - begin();
+    if (tmp > size_)
+      throw std::out_of_range(
+          "s21::small_vector::insert Unable to insert into a position out of "
+          "range of begin() to end()");
+
+    return emplace(pos, value);
+  }
+
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    size_type tmp = pos - begin();
+    if (tmp > size_)
+      throw std::out_of_range(
+          "s21::small_vector::emplace Unable to emplace into a position out "
+          "of range of begin() to end()");
+
+    if (tmp == size_) {
+      emplace_back(std::forward<Args>(args)...);
+    } else {
+      // args may refer to an element that the shift or reallocation moves
+      value_type local(std::forward<Args>(args)...);
+      GrowIfFull();
+      InsertAt(tmp, std::move(local));
+    }
+    return begin() + tmp;
+  }
+
+  iterator erase(iterator pos) {
+    size_type tmp = pos - begin();
+    if (tmp >= size_)
+      throw std::out_of_range(
+          "s21::small_vector::erase Unable to erase a position out of range "
+          "of begin() to end()");
+
+    if constexpr (is_trivially_relocatable_v<value_type>) {
+      std::destroy_at(pos);
+      std::memmove(static_cast<void *>(pos), pos + 1,
+                   (size_ - tmp - 1) * sizeof(value_type));
+    } else {
+      std::move(pos + 1, end(), pos);
+      std::destroy_at(end() - 1);
+    }
+    --size_;
+    return begin() + tmp;
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  template <class... Args>
+  reference emplace_back(Args &&...args) {
+    if (size_ == capacity_) {
+      // args may refer to an element that the reallocation moves away
+      value_type local(std::forward<Args>(args)...);
+      GrowIfFull();
+      ::new (static_cast<void *>(end())) value_type(std::move(local));
+    } else {
+      ::new (static_cast<void *>(end()))
+          value_type(std::forward<Args>(args)...);
+    }
+    ++size_;
+    return *(end() - 1);
+  }
+
+  void pop_back() {
+    if (size_ == 0)
+      throw std::length_error(
+          "s21::small_vector::pop_back Calling pop_back on an empty "
+          "container");
+    --size_;
+    std::destroy_at(end());
+  }
+
+  void swap(small_vector &other) {
+    if (this == &other) return;
+
+    if (!IsInline() && !other.IsInline()) {
+      std::swap(array_, other.array_);
+      std::swap(size_, other.size_);
+      std::swap(capacity_, other.capacity_);
+    } else if (IsInline() && other.IsInline()) {
+      small_vector &longer = size_ >= other.size_ ? *this : other;
+      small_vector &shorter = size_ >= other.size_ ? other : *this;
+      std::swap_ranges(shorter.begin(), shorter.end(), longer.begin());
+      Relocate(longer.begin() + shorter.size_, longer.end(), shorter.end());
+      std::swap(size_, other.size_);
+    } else {
+      small_vector &heap = IsInline() ? other : *this;
+      small_vector &local = IsInline() ? *this : other;
+      // The inline elements move into the heap owner's inline buffer, the
+      // heap block changes hands without touching its elements
+      iterator block = heap.array_;
+      size_type block_capacity = heap.capacity_;
+      heap.array_ = heap.Inline();
+      heap.capacity_ = N;
+      Relocate(local.begin(), local.end(), heap.array_);
+      local.array_ = block;
+      local.capacity_ = block_capacity;
+      std::swap(size_, other.size_);
+    }
+  }
+};
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_SMALL_VECTOR_H
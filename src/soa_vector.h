@@ -0,0 +1,519 @@
+#ifndef CONTAINERS_CPP_SOA_VECTOR_H
+#define CONTAINERS_CPP_SOA_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "growth_policy.h"
+#include "hardening.h"
+#include "trivially_relocatable.h"
+
+namespace s21 {
+
+// Contiguous run of T, what soa_vector::data<I>() returns for a column
+template <class T>
+class span {
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using size_type = std::size_t;
+  using iterator = T *;
+
+  constexpr span() noexcept = default;
+  constexpr span(T *data, size_type size) noexcept : data_(data), size_(size) {}
+
+  constexpr T *data() const noexcept { return data_; }
+  constexpr size_type size() const noexcept { return size_; }
+  constexpr bool empty() const noexcept { return size_ == 0; }
+  constexpr T *begin() const noexcept { return data_; }
+  constexpr T *end() const noexcept { return data_ + size_; }
+
+  constexpr T &operator[](size_type pos) const noexcept {
+    S21_VECTOR_ASSERT(pos < size_, "s21::span::operator[] index out of range");
+    return data_[pos];
+  }
+
+ private:
+  T *data_ = nullptr;
+  size_type size_ = 0;
+};
+
+// Structure of arrays: row i of soa_vector<A, B, C> is the i-th element of
+// three arrays, one per field, so a pass over one field streams just that
+// field through the cache. The columns share one block, each starting on a
+// cache line, and one size and capacity: growth reallocates them together.
+// Rows are read and written through std::tuple<A &, B &, C &> proxies,
+// whole columns through data<I>().
+template <class... Ts>
+class soa_vector {
+  static_assert(sizeof...(Ts) > 0, "s21::soa_vector needs a column");
+
+ public:
+  using value_type = std::tuple<Ts...>;
+  using reference = std::tuple<Ts &...>;
+  using const_reference = std::tuple<const Ts &...>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  template <std::size_t I>
+  using column_type = std::tuple_element_t<I, value_type>;
+
+  static constexpr std::size_t columns = sizeof...(Ts);
+  // Alignment of every column
+  static constexpr std::size_t alignment = std::max({std::size_t{64},
+                                                     alignof(Ts)...});
+
+ private:
+  using Columns = std::tuple<Ts *...>;
+  using Indices = std::index_sequence_for<Ts...>;
+
+  // Growth can't throw and the old block isn't needed once it starts
+  static constexpr bool kNothrowRelocate =
+      ((is_trivially_relocatable_v<Ts> ||
+        std::is_nothrow_move_constructible_v<Ts>)&&...);
+
+  Columns columns_{};
+  size_type size_ = 0;
+  size_type capacity_ = 0;
+
+  static constexpr size_type RoundUp(size_type bytes) noexcept {
+    return (bytes + alignment - 1) & ~(alignment - 1);
+  }
+
+  static Columns Allocate(size_type capacity) {
+    if (!capacity) return Columns{};
+    size_type bytes = (RoundUp(capacity * sizeof(Ts)) + ...);
+    auto *block = static_cast<unsigned char *>(
+        ::operator new(bytes, std::align_val_t{alignment}));
+    Columns result;
+    size_type offset = 0;
+    std::apply(
+        [&](auto *&...column) {
+          ((column = reinterpret_cast<std::remove_reference_t<decltype(
+                column)>>(block + offset),
+            offset += RoundUp(capacity * sizeof(*column))),
+           ...);
+        },
+        result);
+    return result;
+  }
+
+  // The block starts with the first column
+  static void Deallocate(const Columns &block) noexcept {
+    if (std::get<0>(block))
+      ::operator delete(std::get<0>(block), std::align_val_t{alignment});
+  }
+
+  template <std::size_t I = 0>
+  static void Destroy(const Columns &block, size_type first,
+                      size_type last) noexcept {
+    if constexpr (I < columns) {
+      std::destroy(std::get<I>(block) + first, std::get<I>(block) + last);
+      Destroy<I + 1>(block, first, last);
+    }
+  }
+
+  // Builds row `row` of block field by field from the tuple of arguments,
+  // destroying the finished fields if a later one throws
+  template <std::size_t I = 0, class Args>
+  static void ConstructRow(const Columns &block, size_type row, Args &&args) {
+    if constexpr (I < columns) {
+      using T = column_type<I>;
+      ::new (static_cast<void *>(std::get<I>(block) + row))
+          T(std::get<I>(std::forward<Args>(args)));
+      if constexpr (std::is_trivially_destructible_v<T>) {
+        ConstructRow<I + 1>(block, row, std::forward<Args>(args));
+      } else {
+        try {
+          ConstructRow<I + 1>(block, row, std::forward<Args>(args));
+        } catch (...) {
+          std::get<I>(block)[row].~T();
+          throw;
+        }
+      }
+    }
+  }
+
+  // Copies the rows of from into the raw block to, column by column
+  template <std::size_t I = 0>
+  static void CopyRows(const Columns &from, const Columns &to,
+                       size_type count) {
+    if constexpr (I < columns) {
+      std::uninitialized_copy(std::get<I>(from), std::get<I>(from) + count,
+                              std::get<I>(to));
+      try {
+        CopyRows<I + 1>(from, to, count);
+      } catch (...) {
+        std::destroy(std::get<I>(to), std::get<I>(to) + count);
+        throw;
+      }
+    }
+  }
+
+  // Moves the rows into the raw block to. Trivially relocatable columns
+  // are copied bytewise, the others moved, or copied when moving may throw
+  // and then the old block stays intact. Relocated columns of to aren't
+  // destroyed on failure: their objects still belong to the old block
+  template <std::size_t I = 0>
+  void Relocate(const Columns &to) {
+    if constexpr (I < columns) {
+      using T = column_type<I>;
+      T *from = std::get<I>(columns_);
+      if constexpr (is_trivially_relocatable_v<T>) {
+        if (size_) std::memcpy(static_cast<void *>(std::get<I>(to)), from,
+                               size_ * sizeof(T));
+      } else if constexpr (kNothrowRelocate) {
+        std::uninitialized_move(from, from + size_, std::get<I>(to));
+      } else {
+        std::uninitialized_copy(from, from + size_, std::get<I>(to));
+      }
+      try {
+        Relocate<I + 1>(to);
+      } catch (...) {
+        if constexpr (!is_trivially_relocatable_v<T>)
+          std::destroy(std::get<I>(to), std::get<I>(to) + size_);
+        throw;
+      }
+    }
+  }
+
+  // What stays behind in the old block after Relocate()
+  template <std::size_t I = 0>
+  void DestroyRelocated() noexcept {
+    if constexpr (I < columns) {
+      using T = column_type<I>;
+      if constexpr (!is_trivially_relocatable_v<T>)
+        std::destroy(std::get<I>(columns_), std::get<I>(columns_) + size_);
+      DestroyRelocated<I + 1>();
+    }
+  }
+
+  // Moves the rows to a block of new_capacity, building the row at size_
+  // from args there first when Args isn't empty: args may refer to a row
+  // of the old block
+  template <class... Args>
+  void Reallocate(size_type new_capacity, Args &&...args) {
+    Columns block = Allocate(new_capacity);
+    try {
+      if constexpr (sizeof...(Args) > 0)
+        ConstructRow(block, size_,
+                     std::forward_as_tuple(std::forward<Args>(args)...));
+      try {
+        Relocate(block);
+      } catch (...) {
+        if constexpr (sizeof...(Args) > 0) Destroy(block, size_, size_ + 1);
+        throw;
+      }
+    } catch (...) {
+      Deallocate(block);
+      throw;
+    }
+    DestroyRelocated();
+    Deallocate(columns_);
+    columns_ = block;
+    capacity_ = new_capacity;
+  }
+
+  size_type NextCapacity(size_type extra = 1) const {
+    if (extra > max_size() - size_)
+      throw std::length_error(
+          "s21::soa_vector Capacity can't grow beyond max_size()");
+    return std::min<size_type>(
+        growth::doubling::next_capacity(size_, size_ + extra, 0), max_size());
+  }
+
+  template <class Row, class Block, std::size_t... I>
+  static Row MakeRow(const Block &block, size_type row,
+                     std::index_sequence<I...>) noexcept {
+    return Row(std::get<I>(block)[row]...);
+  }
+
+  template <bool Const>
+  class Iter {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = soa_vector::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference =
+        std::conditional_t<Const, soa_vector::const_reference,
+                           soa_vector::reference>;
+    using pointer = void;
+
+    Iter() noexcept = default;
+
+    // iterator converts to const_iterator
+    template <bool Other, class = std::enable_if_t<Const && !Other>>
+    Iter(const Iter<Other> &other) noexcept
+        : vec_(other.vec_), pos_(other.pos_) {}
+
+    reference operator*() const noexcept { return (*vec_)[pos_]; }
+    reference operator[](difference_type n) const noexcept {
+      return (*vec_)[pos_ + n];
+    }
+
+    Iter &operator++() noexcept {
+      ++pos_;
+      return *this;
+    }
+    Iter operator++(int) noexcept { return Iter(vec_, pos_++); }
+    Iter &operator--() noexcept {
+      --pos_;
+      return *this;
+    }
+    Iter operator--(int) noexcept { return Iter(vec_, pos_--); }
+    Iter &operator+=(difference_type n) noexcept {
+      pos_ += n;
+      return *this;
+    }
+    Iter &operator-=(difference_type n) noexcept {
+      pos_ -= n;
+      return *this;
+    }
+
+    friend Iter operator+(Iter it, difference_type n) noexcept {
+      return it += n;
+    }
+    friend Iter operator+(difference_type n, Iter it) noexcept {
+      return it += n;
+    }
+    friend Iter operator-(Iter it, difference_type n) noexcept {
+      return it -= n;
+    }
+    friend difference_type operator-(const Iter &a, const Iter &b) noexcept {
+      return static_cast<difference_type>(a.pos_) -
+             static_cast<difference_type>(b.pos_);
+    }
+    friend bool operator==(const Iter &a, const Iter &b) noexcept {
+      return a.pos_ == b.pos_;
+    }
+    friend bool operator!=(const Iter &a, const Iter &b) noexcept {
+      return a.pos_ != b.pos_;
+    }
+    friend bool operator<(const Iter &a, const Iter &b) noexcept {
+      return a.pos_ < b.pos_;
+    }
+    friend bool operator>(const Iter &a, const Iter &b) noexcept {
+      return a.pos_ > b.pos_;
+    }
+    friend bool operator<=(const Iter &a, const Iter &b) noexcept {
+      return a.pos_ <= b.pos_;
+    }
+    friend bool operator>=(const Iter &a, const Iter &b) noexcept {
+      return a.pos_ >= b.pos_;
+    }
+
+   private:
+    friend class soa_vector;
+    template <bool>
+    friend class Iter;
+
+    using Vec = std::conditional_t<Const, const soa_vector, soa_vector>;
+
+    Iter(Vec *vec, size_type pos) noexcept : vec_(vec), pos_(pos) {}
+
+    Vec *vec_ = nullptr;
+    size_type pos_ = 0;
+  };
+
+ public:
+  // Iterators dereference to row proxies, not to value_type &
+  using iterator = Iter<false>;
+  using const_iterator = Iter<true>;
+
+  // Constructors
+  soa_vector() noexcept {}
+
+  explicit soa_vector(size_type count) : soa_vector() { resize(count); }
+
+  soa_vector(std::initializer_list<value_type> const &init) : soa_vector() {
+    reserve(init.size());
+    for (const value_type &row : init) push_back(row);
+  }
+
+  soa_vector(const soa_vector &other)
+      : columns_(Allocate(other.size_)), capacity_(other.size_) {
+    try {
+      CopyRows(other.columns_, columns_, other.size_);
+    } catch (...) {
+      Deallocate(columns_);
+      throw;
+    }
+    size_ = other.size_;
+  }
+
+  soa_vector(soa_vector &&other) noexcept
+      : columns_(std::exchange(other.columns_, Columns{})),
+        size_(std::exchange(other.size_, 0)),
+        capacity_(std::exchange(other.capacity_, 0)) {}
+
+  // Destructor
+  ~soa_vector() {
+    Destroy(columns_, 0, size_);
+    Deallocate(columns_);
+  }
+
+  soa_vector &operator=(const soa_vector &other) {
+    if (this != &other) {
+      soa_vector tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  soa_vector &operator=(soa_vector &&other) noexcept {
+    if (this != &other) {
+      soa_vector tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  // Element access
+  reference at(size_type pos) {
+    if (pos >= size_)
+      throw std::out_of_range("s21::soa_vector::at The index is out of range");
+    return (*this)[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size_)
+      throw std::out_of_range("s21::soa_vector::at The index is out of range");
+    return (*this)[pos];
+  }
+
+  reference operator[](size_type pos) noexcept {
+    S21_VECTOR_ASSERT(pos < size_,
+                      "s21::soa_vector::operator[] index out of range");
+    return MakeRow<reference>(columns_, pos, Indices{});
+  }
+
+  const_reference operator[](size_type pos) const noexcept {
+    S21_VECTOR_ASSERT(pos < size_,
+                      "s21::soa_vector::operator[] index out of range");
+    return MakeRow<const_reference>(columns_, pos, Indices{});
+  }
+
+  reference front() noexcept { return (*this)[0]; }
+  const_reference front() const noexcept { return (*this)[0]; }
+  reference back() noexcept { return (*this)[size_ - 1]; }
+  const_reference back() const noexcept { return (*this)[size_ - 1]; }
+
+  // Column I of the rows in use
+  template <std::size_t I>
+  span<column_type<I>> data() noexcept {
+    return {std::get<I>(columns_), size_};
+  }
+
+  template <std::size_t I>
+  span<const column_type<I>> data() const noexcept {
+    return {std::get<I>(columns_), size_};
+  }
+
+  // Iterators
+  iterator begin() noexcept { return iterator(this, 0); }
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  iterator end() noexcept { return iterator(this, size_); }
+  const_iterator end() const noexcept { return const_iterator(this, size_); }
+  const_iterator cend() const noexcept { return end(); }
+
+  // Capacity
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return capacity_; }
+
+  size_type max_size() const noexcept {
+    return std::numeric_limits<difference_type>::max() /
+           (RoundUp(sizeof(Ts)) + ...);
+  }
+
+  void reserve(size_type new_capacity) {
+    if (new_capacity <= capacity_) return;
+    if (new_capacity > max_size())
+      throw std::length_error(
+          "s21::soa_vector::reserve Reserve capacity can't be larger than "
+          "max_size()");
+    Reallocate(new_capacity);
+  }
+
+  void shrink_to_fit() {
+    if (size_ == capacity_) return;
+    if (size_) {
+      Reallocate(size_);
+    } else {
+      Deallocate(columns_);
+      columns_ = Columns{};
+      capacity_ = 0;
+    }
+  }
+
+  // Modifiers
+  void clear() noexcept {
+    Destroy(columns_, 0, size_);
+    size_ = 0;
+  }
+
+  // Appends a row built from one argument per column
+  template <class... Args>
+  reference emplace_back(Args &&...args) {
+    static_assert(sizeof...(Args) == columns,
+                  "s21::soa_vector::emplace_back takes one argument per "
+                  "column");
+    if (size_ == capacity_) {
+      Reallocate(NextCapacity(), std::forward<Args>(args)...);
+    } else {
+      ConstructRow(columns_, size_,
+                   std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+    return (*this)[size_++];
+  }
+
+  void push_back(const value_type &row) {
+    std::apply([this](const Ts &...fields) { emplace_back(fields...); }, row);
+  }
+
+  void push_back(value_type &&row) {
+    std::apply([this](Ts &...fields) { emplace_back(std::move(fields)...); },
+               row);
+  }
+
+  void pop_back() {
+    if (empty())
+      throw std::length_error(
+          "s21::soa_vector::pop_back Calling pop_back on an empty "
+          "soa_vector");
+    Destroy(columns_, size_ - 1, size_);
+    --size_;
+  }
+
+  // New rows are value-initialized
+  void resize(size_type count) {
+    if (count < size_) {
+      Destroy(columns_, count, size_);
+      size_ = count;
+      return;
+    }
+    reserve(count);
+    while (size_ < count) emplace_back(Ts()...);
+  }
+
+  void swap(soa_vector &other) noexcept {
+    std::swap(columns_, other.columns_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+  }
+};
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_SOA_VECTOR_H
@@ -0,0 +1,542 @@
+#ifndef CONTAINERS_CPP_STATIC_VECTOR_H
+#define CONTAINERS_CPP_STATIC_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "hardening.h"
+
+namespace s21 {
+
+// What static_vector does when an insertion doesn't fit. A policy is a
+// type with
+//
+//   [[noreturn]] static void on_overflow(const char *message);
+namespace overflow {
+
+struct throw_length_error {
+  [[noreturn]] static void on_overflow(const char *message) {
+    throw std::length_error(message);
+  }
+};
+
+// For code built without exceptions or that must not unwind
+struct abort {
+  [[noreturn]] static void on_overflow(const char *message) noexcept {
+    hardening_failure(message);
+  }
+};
+
+}  // namespace overflow
+
+namespace detail {
+
+// Elements live in uninitialized slots, only [0, size_) is ever alive.
+// Trivially copyable elements keep the container trivially copyable: plain
+// storage with the implicit special members. Trivial ones sit in an array,
+// which C++20 also accepts in constant expressions, the others in raw bytes
+// so no constructor runs for the unused slots.
+template <class T, std::size_t N,
+          bool = std::is_trivially_copyable_v<T> &&
+                 std::is_trivially_destructible_v<T>,
+          bool = std::is_trivial_v<T>>
+struct StaticStorage {
+  std::size_t size_ = 0;
+  alignas(T) std::byte data_[N * sizeof(T)];
+
+  T *Data() noexcept { return reinterpret_cast<T *>(data_); }
+  const T *Data() const noexcept { return reinterpret_cast<const T *>(data_); }
+
+  StaticStorage() noexcept {}
+
+  StaticStorage(const StaticStorage &other) {
+    std::uninitialized_copy(other.Data(), other.Data() + other.size_, Data());
+    size_ = other.size_;
+  }
+
+  // Moves the elements one by one, other keeps its size
+  StaticStorage(StaticStorage &&other) noexcept(
+      std::is_nothrow_move_constructible_v<T>) {
+    std::uninitialized_move(other.Data(), other.Data() + other.size_, Data());
+    size_ = other.size_;
+  }
+
+  StaticStorage &operator=(const StaticStorage &other) {
+    if (this != &other) Assign(other.Data(), other.size_);
+    return *this;
+  }
+
+  StaticStorage &operator=(StaticStorage &&other) noexcept(
+      std::is_nothrow_move_assignable_v<T> &&
+      std::is_nothrow_move_constructible_v<T>) {
+    if (this != &other)
+      Assign(std::make_move_iterator(other.Data()), other.size_);
+    return *this;
+  }
+
+  ~StaticStorage() { std::destroy(Data(), Data() + size_); }
+
+  // Assigns over the common prefix, then constructs or destroys the rest
+  template <class It>
+  void Assign(It first, std::size_t count) {
+    std::size_t common = std::min(size_, count);
+    for (std::size_t i = 0; i < common; ++i, ++first) Data()[i] = *first;
+    if (count > size_) {
+      std::uninitialized_copy_n(first, count - size_, Data() + size_);
+    } else {
+      std::destroy(Data() + count, Data() + size_);
+    }
+    size_ = count;
+  }
+};
+
+template <class T, std::size_t N>
+struct StaticStorage<T, N, true, true> {
+  std::size_t size_ = 0;
+  T data_[N];
+
+  constexpr T *Data() noexcept { return data_; }
+  constexpr const T *Data() const noexcept { return data_; }
+};
+
+template <class T, std::size_t N>
+struct StaticStorage<T, N, true, false> {
+  std::size_t size_ = 0;
+  alignas(T) std::byte data_[N * sizeof(T)];
+
+  T *Data() noexcept { return reinterpret_cast<T *>(data_); }
+  const T *Data() const noexcept { return reinterpret_cast<const T *>(data_); }
+};
+
+}  // namespace detail
+
+// Vector with the s21::vector interface and room for N elements inside the
+// object. It never allocates: an insertion beyond N goes to
+// OverflowPolicy, or is refused by the try_ functions. With trivially
+// copyable T it is trivially copyable itself.
+//
+// Constant expressions need C++20 and trivial T (e.g. arithmetic types and
+// plain structs): C++17 can't evaluate the constructor of storage that is
+// deliberately left uninitialized, and the raw bytes holding other
+// elements are reached through a cast no constant expression allows.
+template <class T, std::size_t N,
+          class OverflowPolicy = overflow::throw_length_error>
+class static_vector : private detail::StaticStorage<T, N> {
+  static_assert(N > 0, "s21::static_vector Capacity must be positive");
+
+  using Storage = detail::StaticStorage<T, N>;
+  using Storage::Data;
+  using Storage::size_;
+
+  static constexpr bool kTrivial = std::is_trivial_v<T>;
+
+ public:
+  // Member types
+  using value_type = T;
+  using overflow_policy = OverflowPolicy;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+ private:
+  template <class It>
+  using RequireInputIterator = std::enable_if_t<std::is_convertible_v<
+      typename std::iterator_traits<It>::iterator_category,
+      std::input_iterator_tag>>;
+
+  template <class... Args>
+  constexpr void ConstructAt(size_type pos, Args &&...args) {
+    if constexpr (kTrivial) {
+      Data()[pos] = T(std::forward<Args>(args)...);
+    } else {
+      ::new (static_cast<void *>(Data() + pos))
+          T(std::forward<Args>(args)...);
+    }
+  }
+
+  constexpr void DestroyRange(size_type first, size_type last) noexcept {
+    if constexpr (!kTrivial) std::destroy(Data() + first, Data() + last);
+  }
+
+  constexpr void Require(size_type count, const char *message) const {
+    if (count > N - size_) OverflowPolicy::on_overflow(message);
+  }
+
+  static constexpr void Reverse(T *first, T *last) {
+    while (first < last && first < --last) {
+      T tmp = std::move(*first);
+      *first = std::move(*last);
+      *last = std::move(tmp);
+      ++first;
+    }
+  }
+
+  // Moves the elements appended from old_size onwards to pos
+  constexpr void RotateIn(size_type pos, size_type old_size) {
+    Reverse(Data() + pos, Data() + old_size);
+    Reverse(Data() + old_size, Data() + size_);
+    Reverse(Data() + pos, Data() + size_);
+  }
+
+  constexpr size_type CheckedPosition(const_iterator pos,
+                                      const char *message) const {
+    size_type index = static_cast<size_type>(pos - begin());
+    if (index > size_) throw std::out_of_range(message);
+    return index;
+  }
+
+ public:
+  // Constructors
+  // User-provided, so static_vector<T, N>{} doesn't zero the slots either
+  constexpr static_vector() noexcept {}
+
+  constexpr explicit static_vector(size_type count) {
+    Require(count,
+            "s21::static_vector::static_vector Size exceeds the capacity");
+    for (; size_ < count; ++size_) ConstructAt(size_);
+  }
+
+  constexpr static_vector(size_type count, const_reference value) {
+    assign(count, value);
+  }
+
+  template <class InputIt, class = RequireInputIterator<InputIt>>
+  constexpr static_vector(InputIt first, InputIt last) {
+    assign(first, last);
+  }
+
+  constexpr static_vector(std::initializer_list<value_type> init) {
+    assign(init.begin(), init.end());
+  }
+
+  constexpr static_vector &operator=(std::initializer_list<value_type> init) {
+    assign(init.begin(), init.end());
+    return *this;
+  }
+
+  constexpr void assign(size_type count, const_reference value) {
+    clear();
+    Require(count, "s21::static_vector::assign Size exceeds the capacity");
+    for (; size_ < count; ++size_) ConstructAt(size_, value);
+  }
+
+  template <class InputIt, class = RequireInputIterator<InputIt>>
+  constexpr void assign(InputIt first, InputIt last) {
+    clear();
+    for (; first != last; ++first) emplace_back(*first);
+  }
+
+  constexpr void assign(std::initializer_list<value_type> init) {
+    assign(init.begin(), init.end());
+  }
+
+  // Iterators
+  constexpr iterator begin() noexcept { return Data(); }
+  constexpr const_iterator begin() const noexcept { return Data(); }
+  constexpr const_iterator cbegin() const noexcept { return Data(); }
+  constexpr iterator end() noexcept { return Data() + size_; }
+  constexpr const_iterator end() const noexcept { return Data() + size_; }
+  constexpr const_iterator cend() const noexcept { return Data() + size_; }
+  constexpr reverse_iterator rbegin() noexcept {
+    return reverse_iterator(end());
+  }
+  constexpr const_reverse_iterator rbegin() const noexcept {
+    return const_reverse_iterator(end());
+  }
+  constexpr reverse_iterator rend() noexcept {
+    return reverse_iterator(begin());
+  }
+  constexpr const_reverse_iterator rend() const noexcept {
+    return const_reverse_iterator(begin());
+  }
+
+  // Element access
+  constexpr reference at(size_type pos) {
+    if (pos >= size_)
+      throw std::out_of_range(
+          "s21::static_vector::at The index is out of range");
+    return Data()[pos];
+  }
+
+  constexpr const_reference at(size_type pos) const {
+    if (pos >= size_)
+      throw std::out_of_range(
+          "s21::static_vector::at The index is out of range");
+    return Data()[pos];
+  }
+
+  // Unchecked, see hardening.h for the debug/hardened precondition check
+  constexpr reference operator[](size_type pos) noexcept {
+    S21_VECTOR_ASSERT(pos < size_,
+                      "s21::static_vector::operator[] The index is out of "
+                      "range");
+    return Data()[pos];
+  }
+
+  constexpr const_reference operator[](size_type pos) const noexcept {
+    S21_VECTOR_ASSERT(pos < size_,
+                      "s21::static_vector::operator[] The index is out of "
+                      "range");
+    return Data()[pos];
+  }
+
+  constexpr reference front() noexcept {
+    S21_VECTOR_ASSERT(size_,
+                      "s21::static_vector::front Called on an empty "
+                      "container");
+    return Data()[0];
+  }
+
+  constexpr const_reference front() const noexcept {
+    S21_VECTOR_ASSERT(size_,
+                      "s21::static_vector::front Called on an empty "
+                      "container");
+    return Data()[0];
+  }
+
+  constexpr reference back() noexcept {
+    S21_VECTOR_ASSERT(size_,
+                      "s21::static_vector::back Called on an empty "
+                      "container");
+    return Data()[size_ - 1];
+  }
+
+  constexpr const_reference back() const noexcept {
+    S21_VECTOR_ASSERT(size_,
+                      "s21::static_vector::back Called on an empty "
+                      "container");
+    return Data()[size_ - 1];
+  }
+
+  constexpr T *data() noexcept { return Data(); }
+  constexpr const T *data() const noexcept { return Data(); }
+
+  // Capacity
+  [[nodiscard]] constexpr bool empty() const noexcept { return !size_; }
+  [[nodiscard]] constexpr bool full() const noexcept { return size_ == N; }
+  [[nodiscard]] constexpr size_type size() const noexcept { return size_; }
+  static constexpr size_type max_size() noexcept { return N; }
+  static constexpr size_type capacity() noexcept { return N; }
+
+  // Nothing to allocate, only checks that new_capacity fits
+  constexpr void reserve(size_type new_capacity) {
+    if (new_capacity > N)
+      OverflowPolicy::on_overflow(
+          "s21::static_vector::reserve Reserve capacity can't be larger "
+          "than N");
+  }
+
+  constexpr void shrink_to_fit() noexcept {}
+
+  // Modifiers
+  constexpr void clear() noexcept {
+    DestroyRange(0, size_);
+    size_ = 0;
+  }
+
+  template <class... Args>
+  constexpr reference emplace_back(Args &&...args) {
+    Require(1, "s21::static_vector::emplace_back The container is full");
+    ConstructAt(size_, std::forward<Args>(args)...);
+    return Data()[size_++];
+  }
+
+  constexpr void push_back(const_reference value) { emplace_back(value); }
+
+  constexpr void push_back(value_type &&value) {
+    emplace_back(std::move(value));
+  }
+
+  // Appends unless the vector is full: the new element, or nullptr and
+  // args are left alone
+  template <class... Args>
+  constexpr T *try_emplace_back(Args &&...args) {
+    if (size_ == N) return nullptr;
+    ConstructAt(size_, std::forward<Args>(args)...);
+    return Data() + size_++;
+  }
+
+  [[nodiscard]] constexpr bool try_push_back(const_reference value) {
+    return try_emplace_back(value) != nullptr;
+  }
+
+  [[nodiscard]] constexpr bool try_push_back(value_type &&value) {
+    return try_emplace_back(std::move(value)) != nullptr;
+  }
+
+  constexpr void pop_back() {
+    if (size_ == 0)
+      throw std::length_error(
+          "s21::static_vector::pop_back Calling pop_back on an empty "
+          "container");
+    --size_;
+    DestroyRange(size_, size_ + 1);
+  }
+
+  template <class... Args>
+  constexpr iterator emplace(const_iterator pos, Args &&...args) {
+    size_type index = CheckedPosition(
+        pos,
+        "s21::static_vector::emplace Unable to emplace into a position out "
+        "of range of begin() to end()");
+    size_type old_size = size_;
+    emplace_back(std::forward<Args>(args)...);
+    RotateIn(index, old_size);
+    return begin() + index;
+  }
+
+  constexpr iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  constexpr iterator insert(const_iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  constexpr iterator insert(const_iterator pos, size_type count,
+                            const_reference value) {
+    size_type index = CheckedPosition(
+        pos,
+        "s21::static_vector::insert Unable to insert into a position out of "
+        "range of begin() to end()");
+    Require(count, "s21::static_vector::insert Size exceeds the capacity");
+    size_type old_size = size_;
+    for (; size_ < old_size + count; ++size_) ConstructAt(size_, value);
+    RotateIn(index, old_size);
+    return begin() + index;
+  }
+
+  template <class InputIt, class = RequireInputIterator<InputIt>>
+  constexpr iterator insert(const_iterator pos, InputIt first,
+                            InputIt last) {
+    size_type index = CheckedPosition(
+        pos,
+        "s21::static_vector::insert Unable to insert into a position out of "
+        "range of begin() to end()");
+    size_type old_size = size_;
+    for (; first != last; ++first) emplace_back(*first);
+    RotateIn(index, old_size);
+    return begin() + index;
+  }
+
+  constexpr iterator insert(const_iterator pos,
+                            std::initializer_list<value_type> init) {
+    return insert(pos, init.begin(), init.end());
+  }
+
+  constexpr iterator erase(const_iterator pos) {
+    size_type index = static_cast<size_type>(pos - begin());
+    if (index >= size_)
+      throw std::out_of_range(
+          "s21::static_vector::erase Unable to erase a position out of "
+          "range of begin() to end()");
+    return erase(pos, pos + 1);
+  }
+
+  constexpr iterator erase(const_iterator first, const_iterator last) {
+    size_type from = static_cast<size_type>(first - begin());
+    size_type to = static_cast<size_type>(last - begin());
+    if (from > to || to > size_)
+      throw std::out_of_range(
+          "s21::static_vector::erase Unable to erase a range out of range "
+          "of begin() to end()");
+    for (size_type i = to; i < size_; ++i)
+      Data()[from + i - to] = std::move(Data()[i]);
+    DestroyRange(size_ - (to - from), size_);
+    size_ -= to - from;
+    return begin() + from;
+  }
+
+  // O(1) removal moving the last element into pos, see vector
+  constexpr iterator unordered_erase(const_iterator pos) {
+    size_type index = static_cast<size_type>(pos - begin());
+    if (index >= size_)
+      throw std::out_of_range(
+          "s21::static_vector::unordered_erase Unable to erase a position "
+          "out of range of begin() to end()");
+    if (index != size_ - 1) Data()[index] = std::move(Data()[size_ - 1]);
+    pop_back();
+    return begin() + index;
+  }
+
+  // New elements are value-initialized
+  constexpr void resize(size_type count) {
+    if (count > size_) {
+      Require(count - size_,
+              "s21::static_vector::resize Size exceeds the capacity");
+      for (; size_ < count; ++size_) ConstructAt(size_);
+    } else {
+      DestroyRange(count, size_);
+      size_ = count;
+    }
+  }
+
+  constexpr void resize(size_type count, const_reference value) {
+    if (count > size_) {
+      Require(count - size_,
+              "s21::static_vector::resize Size exceeds the capacity");
+      for (; size_ < count; ++size_) ConstructAt(size_, value);
+    } else {
+      DestroyRange(count, size_);
+      size_ = count;
+    }
+  }
+
+  // Swaps element by element, there's no storage to exchange
+  constexpr void swap(static_vector &other) noexcept(
+      std::is_nothrow_move_constructible_v<T> &&
+      std::is_nothrow_swappable_v<T>) {
+    static_vector &longer = size_ >= other.size_ ? *this : other;
+    static_vector &shorter = size_ >= other.size_ ? other : *this;
+    for (size_type i = 0; i < shorter.size_; ++i) {
+      T tmp = std::move(longer.Data()[i]);
+      longer.Data()[i] = std::move(shorter.Data()[i]);
+      shorter.Data()[i] = std::move(tmp);
+    }
+    for (size_type i = shorter.size_; i < longer.size_; ++i)
+      shorter.ConstructAt(i, std::move(longer.Data()[i]));
+    size_type common = shorter.size_;
+    shorter.size_ = longer.size_;
+    longer.DestroyRange(common, longer.size_);
+    longer.size_ = common;
+  }
+};
+
+template <class T, std::size_t N, class OverflowPolicy, class Predicate>
+constexpr std::size_t erase_if(static_vector<T, N, OverflowPolicy> &vec,
+                               Predicate pred) {
+  auto kept = vec.begin();
+  for (auto it = vec.begin(); it != vec.end(); ++it) {
+    if (!pred(*it)) {
+      if (kept != it) *kept = std::move(*it);
+      ++kept;
+    }
+  }
+  std::size_t removed = static_cast<std::size_t>(vec.end() - kept);
+  vec.erase(kept, vec.end());
+  return removed;
+}
+
+template <class T, std::size_t N, class OverflowPolicy, class U>
+constexpr std::size_t erase(static_vector<T, N, OverflowPolicy> &vec,
+                            const U &value) {
+  return erase_if(vec, [&value](const T &element) {
+    return element == value;
+  });
+}
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_STATIC_VECTOR_H
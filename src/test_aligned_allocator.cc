@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+
+#include "aligned_allocator.h"
+
+namespace {
+
+template <class Vector>
+bool Aligned(const Vector &v, std::size_t alignment) {
+  return reinterpret_cast<std::uintptr_t>(v.data()) % alignment == 0;
+}
+
+template <std::size_t Alignment, class T>
+void CheckEveryOperation(const T &value) {
+  using Vector = s21::aligned_vector<T, Alignment>;
+  Vector v;
+  for (int i = 0; i < 100; ++i) {
+    v.push_back(value);
+    ASSERT_TRUE(Aligned(v, Alignment)) << "push_back " << i;
+  }
+  v.reserve(1000);
+  EXPECT_TRUE(Aligned(v, Alignment)) << "reserve";
+  while (v.size() > 37) v.pop_back();
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 37);
+  EXPECT_TRUE(Aligned(v, Alignment)) << "shrink_to_fit";
+  v.insert(v.begin() + 3, 200, value);
+  EXPECT_TRUE(Aligned(v, Alignment)) << "insert";
+  v.emplace(v.begin(), value);
+  EXPECT_TRUE(Aligned(v, Alignment)) << "emplace";
+  v.erase(v.begin() + 10);
+  EXPECT_TRUE(Aligned(v, Alignment)) << "erase";
+
+  Vector copy(v);
+  EXPECT_TRUE(Aligned(copy, Alignment)) << "copy";
+  Vector moved(std::move(copy));
+  EXPECT_TRUE(Aligned(moved, Alignment)) << "move";
+  Vector assigned;
+  assigned = v;
+  EXPECT_TRUE(Aligned(assigned, Alignment)) << "copy assignment";
+  assigned = std::move(moved);
+  EXPECT_TRUE(Aligned(assigned, Alignment)) << "move assignment";
+  Vector filled(5, value);
+  EXPECT_TRUE(Aligned(filled, Alignment)) << "fill constructor";
+  filled.swap(v);
+  EXPECT_TRUE(Aligned(filled, Alignment)) << "swap";
+  EXPECT_TRUE(Aligned(v, Alignment)) << "swap";
+  v.clear();
+  v.shrink_to_fit();
+  v.push_back(value);
+  EXPECT_TRUE(Aligned(v, Alignment)) << "push_back after release";
+}
+
+}  // namespace
+
+TEST(AlignedAllocator, Blocks) {
+  s21::aligned_allocator<char, 4096> alloc;
+  char *p = alloc.allocate(1);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % 4096, 0);
+  alloc.deallocate(p, 1);
+  // Rebinding keeps the alignment, raised to alignof(U) if needed
+  s21::aligned_allocator<double, 4096>::rebind<int>::other rebound(alloc);
+  EXPECT_EQ(rebound.alignment, 4096);
+  EXPECT_EQ((s21::aligned_allocator<long double, 1>::alignment),
+            alignof(long double));
+  EXPECT_TRUE(alloc == rebound);
+  s21::aligned_allocator<std::uint64_t> big;
+  EXPECT_THROW(static_cast<void>(big.allocate(std::size_t{1} << 62)),
+               std::bad_alloc);
+}
+
+TEST(AlignedVector, Float32) { CheckEveryOperation<32>(1.5f); }
+
+TEST(AlignedVector, CacheLine) { CheckEveryOperation<64>(std::uint64_t{7}); }
+
+TEST(AlignedVector, Page) { CheckEveryOperation<4096>(short{3}); }
+
+TEST(AlignedVector, NonTrivialElements) {
+  CheckEveryOperation<64>(std::string("not trivially relocatable"));
+}
+
+TEST(AlignedVector, CapacityFillsWholeLines) {
+  s21::aligned_vector<float> v;
+  for (int i = 0; i < 1000; ++i) {
+    v.push_back(static_cast<float>(i));
+    ASSERT_EQ(v.capacity() * sizeof(float) % 64, 0) << v.capacity();
+  }
+  EXPECT_EQ(v[999], 999.0f);
+  // Smaller alignments still pad to a cache line
+  s21::aligned_vector<float, 32> avx;
+  for (int i = 0; i < 100; ++i) {
+    avx.push_back(static_cast<float>(i));
+    ASSERT_EQ(avx.capacity() * sizeof(float) % 64, 0) << avx.capacity();
+  }
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+
+#include "arena_allocator.h"
+#include "vector.h"
+
+TEST(MonotonicBuffer, AllocationsAreAligned) {
+  s21::monotonic_buffer buffer;
+  for (std::size_t alignment : {1, 2, 8, 16, 64, 256}) {
+    static_cast<void>(buffer.allocate(3, 1));
+    void *ptr = buffer.allocate(10, alignment);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alignment, 0);
+  }
+}
+
+TEST(MonotonicBuffer, ChunksGrowGeometrically) {
+  s21::monotonic_buffer buffer(64);
+  for (int i = 0; i < 1000; ++i) static_cast<void>(buffer.allocate(64, 8));
+  EXPECT_GT(buffer.upstream_allocations(), 1);
+  EXPECT_LT(buffer.upstream_allocations(), 16);
+}
+
+TEST(MonotonicBuffer, UsesInitialBufferFirst) {
+  alignas(16) unsigned char storage[256];
+  s21::monotonic_buffer buffer(storage, sizeof(storage));
+  void *ptr = buffer.allocate(128, 16);
+  EXPECT_GE(static_cast<unsigned char *>(ptr), storage);
+  EXPECT_LT(static_cast<unsigned char *>(ptr), storage + sizeof(storage));
+  EXPECT_EQ(buffer.upstream_allocations(), 0);
+  static_cast<void>(buffer.allocate(256, 16));
+  EXPECT_EQ(buffer.upstream_allocations(), 1);
+  buffer.release();
+  EXPECT_EQ(buffer.allocate(16, 16), static_cast<void *>(storage));
+}
+
+TEST(ArenaAllocator, VectorAllocatesFromBuffer) {
+  s21::monotonic_buffer buffer;
+  {
+    s21::vector<int, s21::arena_allocator<int>> v{
+        s21::arena_allocator<int>(buffer)};
+    for (int i = 0; i < 1000; ++i) v.push_back(i);
+    for (int i = 0; i < 1000; ++i) EXPECT_EQ(v[i], i);
+    EXPECT_EQ(v.get_allocator().buffer(), &buffer);
+  }
+  EXPECT_LE(buffer.upstream_allocations(), 4);
+}
+
+TEST(ArenaAllocator, StringsInArena) {
+  s21::monotonic_buffer buffer;
+  s21::arena_allocator<std::string> alloc(buffer);
+  s21::vector<std::string, s21::arena_allocator<std::string>> v(alloc);
+  v.push_back("first string long enough to leave the small buffer");
+  v.push_back("second");
+  v.insert(v.begin(), "zeroth");
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(v[0], "zeroth");
+  EXPECT_EQ(v[2], "second");
+}
+
+TEST(ArenaAllocator, MovePropagatesAllocator) {
+  s21::monotonic_buffer first;
+  s21::monotonic_buffer second;
+  using arena_vector = s21::vector<int, s21::arena_allocator<int>>;
+  arena_vector a({1, 2, 3}, s21::arena_allocator<int>(first));
+  arena_vector b{s21::arena_allocator<int>(second)};
+  b = std::move(a);
+  EXPECT_EQ(b.get_allocator().buffer(), &first);
+  EXPECT_EQ(b.size(), 3);
+  EXPECT_EQ(b[2], 3);
+}
+
+TEST(ArenaAllocator, CopyAssignmentKeepsAllocator) {
+  s21::monotonic_buffer first;
+  s21::monotonic_buffer second;
+  using arena_vector = s21::vector<int, s21::arena_allocator<int>>;
+  arena_vector a({1, 2, 3}, s21::arena_allocator<int>(first));
+  arena_vector b{s21::arena_allocator<int>(second)};
+  b = a;
+  EXPECT_EQ(b.get_allocator().buffer(), &second);
+  EXPECT_EQ(b.size(), 3);
+  EXPECT_EQ(b[0], 1);
+
+  arena_vector c(a, s21::arena_allocator<int>(second));
+  EXPECT_EQ(c.get_allocator().buffer(), &second);
+  EXPECT_EQ(c[1], 2);
+}
+
+TEST(ArenaAllocator, SwapPropagatesAllocator) {
+  s21::monotonic_buffer first;
+  s21::monotonic_buffer second;
+  using arena_vector = s21::vector<int, s21::arena_allocator<int>>;
+  arena_vector a({1, 2, 3}, s21::arena_allocator<int>(first));
+  arena_vector b({4}, s21::arena_allocator<int>(second));
+  a.swap(b);
+  EXPECT_EQ(a.get_allocator().buffer(), &second);
+  EXPECT_EQ(b.get_allocator().buffer(), &first);
+  EXPECT_EQ(a[0], 4);
+  EXPECT_EQ(b[0], 1);
+}
+
+TEST(ArenaAllocator, GrowsInPlace) {
+  s21::monotonic_buffer buffer(1 << 16);
+  s21::vector<int, s21::arena_allocator<int>> v{
+      s21::arena_allocator<int>(buffer)};
+  v.push_back(0);
+  const int *first = v.data();
+  for (int i = 1; i < 1000; ++i) v.push_back(i);
+  EXPECT_EQ(v.data(), first);
+  EXPECT_EQ(buffer.upstream_allocations(), 1);
+  for (int i = 0; i < 1000; ++i) EXPECT_EQ(v[i], i);
+}
+
+TEST(MonotonicBuffer, ReallocateCopiesWhenNotOnTop) {
+  s21::monotonic_buffer buffer;
+  auto *first = static_cast<int *>(buffer.allocate(4 * sizeof(int)));
+  for (int i = 0; i < 4; ++i) first[i] = i;
+  static_cast<void>(buffer.allocate(16));
+  auto *moved = static_cast<int *>(
+      buffer.reallocate(first, 4 * sizeof(int), 8 * sizeof(int)));
+  EXPECT_NE(moved, first);
+  for (int i = 0; i < 4; ++i) EXPECT_EQ(moved[i], i);
+}
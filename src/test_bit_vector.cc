@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "bit_vector.h"
+
+namespace {
+
+// A bit_vector and the same bits as std::vector<bool>
+struct Pair {
+  s21::bit_vector bits;
+  std::vector<bool> expected;
+};
+
+Pair Random(std::size_t size, std::uint32_t seed, int percent = 50) {
+  std::mt19937 gen(seed);
+  Pair result;
+  for (std::size_t i = 0; i < size; ++i) {
+    bool bit = static_cast<int>(gen() % 100) < percent;
+    result.bits.push_back(bit);
+    result.expected.push_back(bit);
+  }
+  return result;
+}
+
+void ExpectSame(const s21::bit_vector &bits,
+                const std::vector<bool> &expected) {
+  ASSERT_EQ(bits.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i)
+    ASSERT_EQ(bits[i], expected[i]) << "at " << i;
+}
+
+}  // namespace
+
+TEST(BitVector, PushPopAndAccess) {
+  auto [bits, expected] = Random(200, 1);
+  ExpectSame(bits, expected);
+  EXPECT_EQ(bits.num_words(), 4);
+  for (int i = 0; i < 70; ++i) {
+    bits.pop_back();
+    expected.pop_back();
+  }
+  ExpectSame(bits, expected);
+  EXPECT_EQ(bits.num_words(), 3);
+  bits[3] = !bits[3];
+  expected[3] = !expected[3];
+  bits.flip(4);
+  expected[4] = !expected[4];
+  bits.set(5);
+  expected[5] = true;
+  bits.reset(6);
+  expected[6] = false;
+  ExpectSame(bits, expected);
+  EXPECT_THROW(bits.test(bits.size()), std::out_of_range);
+  bits.clear();
+  EXPECT_THROW(bits.pop_back(), std::length_error);
+}
+
+TEST(BitVector, ConstructAndResize) {
+  s21::bit_vector ones(70, true);
+  EXPECT_EQ(ones.count(), 70);
+  EXPECT_TRUE(ones.all());
+  ones.resize(130, false);
+  EXPECT_EQ(ones.count(), 70);
+  ones.resize(200, true);
+  EXPECT_EQ(ones.count(), 140);
+  EXPECT_FALSE(ones[100]);
+  EXPECT_TRUE(ones[150]);
+  ones.resize(65);
+  EXPECT_EQ(ones.count(), 65);
+  EXPECT_EQ(ones.num_words(), 2);
+  s21::bit_vector init{true, false, true};
+  EXPECT_EQ(init.count(), 2);
+  EXPECT_EQ(init, (s21::bit_vector{true, false, true}));
+}
+
+TEST(BitVector, CountRankSelect) {
+  auto [bits, expected] = Random(1000, 2, 30);
+  std::size_t ones = 0;
+  std::vector<std::size_t> positions;
+  for (std::size_t i = 0; i <= expected.size(); ++i) {
+    EXPECT_EQ(bits.rank(i), ones);
+    if (i < expected.size() && expected[i]) {
+      ++ones;
+      positions.push_back(i);
+    }
+  }
+  EXPECT_EQ(bits.count(), ones);
+  for (std::size_t k = 0; k < positions.size(); ++k)
+    EXPECT_EQ(bits.select(k), positions[k]);
+  EXPECT_EQ(bits.select(positions.size()), s21::bit_vector::npos);
+}
+
+TEST(BitVector, CountWithoutPopcnt) {
+  auto [bits, expected] = Random(777, 3);
+  std::size_t native = bits.count();
+  s21::simd::isa level = s21::simd::active_isa();
+  s21::simd::set_isa(s21::simd::isa::scalar);
+  EXPECT_EQ(bits.count(), native);
+  s21::simd::set_isa(level);
+}
+
+TEST(BitVector, FindFirstAndNext) {
+  s21::bit_vector bits(300);
+  EXPECT_EQ(bits.find_first(), s21::bit_vector::npos);
+  EXPECT_TRUE(bits.none());
+  bits.set(5);
+  bits.set(64);
+  bits.set(299);
+  EXPECT_EQ(bits.find_first(), 5);
+  EXPECT_EQ(bits.find_next(5), 5);
+  EXPECT_EQ(bits.find_next(6), 64);
+  EXPECT_EQ(bits.find_next(65), 299);
+  EXPECT_EQ(bits.find_next(300), s21::bit_vector::npos);
+  std::vector<std::size_t> found;
+  for (auto i = bits.find_first(); i != s21::bit_vector::npos;
+       i = bits.find_next(i + 1))
+    found.push_back(i);
+  EXPECT_EQ(found, (std::vector<std::size_t>{5, 64, 299}));
+}
+
+TEST(BitVector, BulkOperations) {
+  auto a = Random(150, 4);
+  auto b = Random(150, 5);
+  auto check = [&](auto op, const s21::bit_vector &result) {
+    std::vector<bool> expected(150);
+    for (std::size_t i = 0; i < 150; ++i)
+      expected[i] = op(a.expected[i], b.expected[i]);
+    ExpectSame(result, expected);
+  };
+  check([](bool x, bool y) { return x && y; }, a.bits & b.bits);
+  check([](bool x, bool y) { return x || y; }, a.bits | b.bits);
+  check([](bool x, bool y) { return x != y; }, a.bits ^ b.bits);
+  check([](bool x, bool) { return !x; }, ~a.bits);
+  check([](bool x, bool y) { return x && !y; },
+        s21::bit_vector(a.bits).and_not(b.bits));
+  EXPECT_EQ((~a.bits).count(), 150 - a.bits.count());
+  EXPECT_THROW(a.bits &= s21::bit_vector(10), std::invalid_argument);
+}
+
+TEST(BitVector, Iterators) {
+  auto [bits, expected] = Random(100, 6);
+  std::vector<bool> copy(bits.begin(), bits.end());
+  EXPECT_EQ(copy, expected);
+  EXPECT_EQ(bits.end() - bits.begin(), 100);
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "compressed_vector.h"
+
+namespace {
+
+template <class T>
+void ExpectSame(const s21::compressed_vector<T> &compressed,
+                const std::vector<T> &expected) {
+  ASSERT_EQ(compressed.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i)
+    ASSERT_EQ(compressed[i], expected[i]) << "at " << i;
+  std::vector<T> scanned(compressed.begin(), compressed.end());
+  EXPECT_EQ(scanned, expected);
+  s21::vector<T> decoded{T{7}};
+  compressed.decode(decoded);
+  ASSERT_EQ(decoded.size(), expected.size() + 1);
+  EXPECT_EQ(decoded[0], T{7});
+  EXPECT_TRUE(
+      std::equal(expected.begin(), expected.end(), decoded.begin() + 1));
+}
+
+std::vector<std::uint64_t> SortedIds(std::size_t count, std::uint32_t seed) {
+  std::mt19937_64 gen(seed);
+  std::vector<std::uint64_t> ids;
+  std::uint64_t id = 1'000'000'000'000;
+  for (std::size_t i = 0; i < count; ++i) ids.push_back(id += gen() % 100);
+  return ids;
+}
+
+}  // namespace
+
+TEST(CompressedVector, SortedIds) {
+  auto ids = SortedIds(1024, 1);
+  s21::compressed_vector<> compressed(ids.begin(), ids.end());
+  ExpectSame(compressed, ids);
+  EXPECT_EQ(compressed.num_blocks(), 8);
+  // Differences below 100 take 7 bits, all blocks are full
+  EXPECT_LT(compressed.memory_bytes(), ids.size() * 8 / 6);
+}
+
+TEST(CompressedVector, FrameOfReference) {
+  std::mt19937_64 gen(2);
+  std::vector<std::uint64_t> values;
+  for (int i = 0; i < 640; ++i) values.push_back((1ull << 50) + gen() % 4096);
+  s21::compressed_vector<> compressed(values.begin(), values.end());
+  ExpectSame(compressed, values);
+  EXPECT_LT(compressed.memory_bytes(), values.size() * 8 / 4);
+}
+
+TEST(CompressedVector, AllWidths) {
+  std::mt19937_64 gen(3);
+  std::vector<std::uint64_t> values;
+  for (unsigned bits = 0; bits <= 64; ++bits) {
+    std::uint64_t mask = bits ? ~std::uint64_t{0} >> (64 - bits) : 0;
+    for (std::size_t i = 0; i < s21::compressed_vector<>::block_size; ++i)
+      values.push_back(gen() & mask);
+  }
+  values.push_back(5);
+  s21::compressed_vector<> compressed(values.begin(), values.end());
+  ExpectSame(compressed, values);
+  EXPECT_EQ(compressed.back(), 5);
+}
+
+TEST(CompressedVector, ConstantAndExtremes) {
+  std::vector<std::uint64_t> values(300, 42);
+  values.push_back(0);
+  values.push_back(~std::uint64_t{0});
+  s21::compressed_vector<> compressed(values.begin(), values.end());
+  ExpectSame(compressed, values);
+}
+
+TEST(CompressedVector, Uint32) {
+  std::vector<std::uint32_t> values;
+  for (std::uint32_t i = 0; i < 500; ++i) values.push_back(i * i);
+  s21::compressed_vector<std::uint32_t> compressed;
+  for (auto value : values) compressed.push_back(value);
+  ExpectSame(compressed, values);
+}
+
+TEST(CompressedVector, LowerBound) {
+  auto ids = SortedIds(1000, 4);
+  ids.insert(ids.begin() + 300, 40, ids[300]);  // Runs across a block edge
+  s21::compressed_vector<> compressed(ids.begin(), ids.end());
+  std::mt19937_64 gen(5);
+  std::vector<std::uint64_t> probes{0, ids.front(), ids.back(),
+                                    ids.back() + 1, ids[300], ids[383]};
+  for (int i = 0; i < 500; ++i)
+    probes.push_back(ids.front() + gen() % (ids.back() - ids.front() + 10));
+  for (auto probe : probes) {
+    auto expected = static_cast<std::size_t>(
+        std::lower_bound(ids.begin(), ids.end(), probe) - ids.begin());
+    ASSERT_EQ(compressed.lower_bound(probe), expected) << probe;
+  }
+}
+
+TEST(CompressedVector, DecodeBlockAndAccess) {
+  s21::compressed_vector<> compressed{5, 3, 9};
+  std::uint64_t out[s21::compressed_vector<>::block_size];
+  EXPECT_EQ(compressed.decode_block(0, out), 3);
+  EXPECT_EQ(out[2], 9);
+  EXPECT_EQ(compressed.front(), 5);
+  EXPECT_THROW(compressed.at(3), std::out_of_range);
+  compressed.clear();
+  EXPECT_TRUE(compressed.empty());
+  EXPECT_EQ(compressed.begin(), compressed.end());
+  EXPECT_EQ(compressed.lower_bound(1), 0);
+}
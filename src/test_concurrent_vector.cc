@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "concurrent_vector.h"
+
+namespace {
+
+struct ThrowsOnNegative {
+  int value = 0;
+
+  ThrowsOnNegative() noexcept = default;
+  explicit ThrowsOnNegative(int v) : value(v) {
+    if (v < 0) throw std::invalid_argument("negative");
+  }
+};
+
+}  // namespace
+
+TEST(ConcurrentVector, PushBackAndRead) {
+  s21::concurrent_vector<std::string> v;
+  EXPECT_TRUE(v.empty());
+  for (int i = 0; i < 1000; ++i) v.push_back(std::to_string(i));
+  ASSERT_EQ(v.size(), 1000);
+  for (int i = 0; i < 1000; ++i) EXPECT_EQ(v[i], std::to_string(i));
+  EXPECT_EQ(v.at(999), "999");
+  EXPECT_THROW(v.at(1000), std::out_of_range);
+  EXPECT_FALSE(v.is_published(1000));
+}
+
+TEST(ConcurrentVector, ReferencesStayValid) {
+  s21::concurrent_vector<int> v;
+  int &first = v.emplace_back(42);
+  const int *address = &first;
+  for (int i = 0; i < 100000; ++i) v.push_back(i);
+  EXPECT_EQ(&v[0], address);
+  EXPECT_EQ(first, 42);
+}
+
+TEST(ConcurrentVector, GrowBy) {
+  s21::concurrent_vector<int> v;
+  EXPECT_EQ(v.grow_by(3, 7), 0);
+  std::vector<int> more{1, 2, 3, 4};
+  EXPECT_EQ(v.grow_by(more.begin(), more.end()), 3);
+  EXPECT_EQ(v.grow_by(200), 7);
+  ASSERT_EQ(v.size(), 207);
+  EXPECT_EQ(v[2], 7);
+  EXPECT_EQ(v[6], 4);
+  EXPECT_EQ(v[206], 0);
+}
+
+TEST(ConcurrentVector, SnapshotKeepsItsSize) {
+  s21::concurrent_vector<int> v;
+  for (int i = 0; i < 100; ++i) v.push_back(i);
+  auto snapshot = v.snapshot();
+  for (int i = 0; i < 100; ++i) v.push_back(-i);
+  EXPECT_EQ(snapshot.size(), 100);
+  EXPECT_EQ(v.size(), 200);
+  EXPECT_EQ(std::count_if(snapshot.begin(), snapshot.end(),
+                          [](int x) { return x >= 0; }),
+            100);
+  EXPECT_EQ(snapshot.end() - snapshot.begin(), 100);
+  EXPECT_EQ(snapshot.begin()[99], 99);
+  EXPECT_TRUE(std::is_sorted(snapshot.begin(), snapshot.end()));
+}
+
+TEST(ConcurrentVector, ThrowingConstructorKeepsPrefixGoing) {
+  s21::concurrent_vector<ThrowsOnNegative> v;
+  v.emplace_back(1);
+  EXPECT_THROW(v.emplace_back(-1), std::invalid_argument);
+  v.emplace_back(3);
+  ASSERT_EQ(v.size(), 3);
+  EXPECT_EQ(v[1].value, 0);
+  EXPECT_EQ(v[2].value, 3);
+}
+
+TEST(ConcurrentVector, DestroysElements) {
+  auto counter = std::make_shared<int>();
+  {
+    s21::concurrent_vector<std::shared_ptr<int>> v;
+    v.grow_by(500, counter);
+    EXPECT_EQ(counter.use_count(), 501);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+// Writers append (thread, sequence) pairs while readers walk snapshots:
+// every published element is complete and each writer's sequence keeps
+// its order. Build with -DS21_SANITIZE_THREAD=ON to run it under TSan.
+TEST(ConcurrentVector, StressWritersAndReaders) {
+  constexpr int kWriters = 4;
+  constexpr int kPerWriter = 20000;
+  struct Item {
+    int thread;
+    int sequence;
+  };
+  s21::concurrent_vector<Item> v;
+  std::atomic<int> writers_done{0};
+  std::atomic<bool> reader_failed{false};
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kWriters; ++t) {
+    threads.emplace_back([&v, &writers_done, t] {
+      for (int i = 0; i < kPerWriter; ++i) {
+        if (i % 100 == 0) {
+          Item batch[3] = {{t, i}, {t, i + 1}, {t, i + 2}};
+          v.grow_by(batch, batch + 3);
+          i += 2;
+        } else {
+          v.push_back(Item{t, i});
+        }
+      }
+      ++writers_done;
+    });
+  }
+  for (int r = 0; r < 2; ++r) {
+    threads.emplace_back([&] {
+      while (writers_done.load() < kWriters) {
+        auto snapshot = v.snapshot();
+        int last[kWriters] = {-1, -1, -1, -1};
+        for (const Item &item : snapshot) {
+          if (item.thread < 0 || item.thread >= kWriters ||
+              item.sequence <= last[item.thread])
+            reader_failed = true;
+          else
+            last[item.thread] = item.sequence;
+        }
+      }
+    });
+  }
+  for (std::thread &thread : threads) thread.join();
+
+  EXPECT_FALSE(reader_failed);
+  ASSERT_EQ(v.size(), kWriters * kPerWriter);
+  std::vector<int> count(kWriters);
+  for (const Item &item : v.snapshot()) ++count[item.thread];
+  for (int t = 0; t < kWriters; ++t) EXPECT_EQ(count[t], kPerWriter);
+}
@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "flat_map.h"
+
+namespace {
+
+template <class Map>
+void ExpectSame(const Map &map, const std::map<int, int> &expected) {
+  ASSERT_EQ(map.size(), expected.size());
+  auto it = expected.begin();
+  for (auto [key, value] : map) {
+    EXPECT_EQ(key, it->first);
+    EXPECT_EQ(value, it->second);
+    ++it;
+  }
+}
+
+// Copying throws once the budget is used up, moving may throw too, so the
+// map has to copy to keep its pairs safe
+struct Fragile {
+  static inline int copies_left = -1;
+  int value = 0;
+
+  Fragile(int v) : value(v) {}
+  Fragile(const Fragile &other) : value(other.value) {
+    if (copies_left == 0) throw std::runtime_error("copy");
+    if (copies_left > 0) --copies_left;
+  }
+  Fragile(Fragile &&other) : value(other.value) {}
+  Fragile &operator=(const Fragile &) = default;
+  Fragile &operator=(Fragile &&) = default;
+};
+
+// Can't be copied and its move throws once the budget is used up
+struct Stiff {
+  static inline int moves_left = -1;
+  int value = 0;
+
+  Stiff(int v) : value(v) {}
+  Stiff(const Stiff &) = delete;
+  Stiff(Stiff &&other) : value(other.value) {
+    if (moves_left == 0) throw std::runtime_error("move");
+    if (moves_left > 0) --moves_left;
+  }
+  Stiff &operator=(const Stiff &) = delete;
+  Stiff &operator=(Stiff &&) = default;
+};
+
+}  // namespace
+
+TEST(FlatMap, InsertAndAccess) {
+  s21::flat_map<int, std::string> map;
+  EXPECT_TRUE(map.insert({2, "two"}).second);
+  EXPECT_FALSE(map.insert({2, "deux"}).second);
+  EXPECT_TRUE(map.try_emplace(1, 3, 'x').second);
+  EXPECT_TRUE(map.emplace(3, "three").second);
+  map[4] = "four";
+  EXPECT_EQ(map.at(2), "two");
+  EXPECT_EQ(map.at(1), "xxx");
+  EXPECT_EQ(map[4], "four");
+  EXPECT_THROW(map.at(5), std::out_of_range);
+  EXPECT_FALSE(map.insert_or_assign(2, "deux").second);
+  EXPECT_EQ(map.at(2), "deux");
+  ASSERT_EQ(map.size(), 4);
+  EXPECT_EQ(map.keys()[0], 1);
+  EXPECT_EQ(map.values()[3], "four");
+}
+
+TEST(FlatMap, IteratorsAndErase) {
+  s21::flat_map<int, int> map{{3, 30}, {1, 10}, {2, 20}};
+  auto it = map.find(2);
+  ASSERT_NE(it, map.end());
+  EXPECT_EQ(it->first, 2);
+  it->second = 21;
+  EXPECT_EQ((*it).second, 21);
+  EXPECT_EQ(map.end() - map.begin(), 3);
+  EXPECT_EQ(map.begin()[2].second, 30);
+  EXPECT_EQ(map.rbegin()->first, 3);
+  s21::flat_map<int, int>::const_iterator cit = map.begin();
+  EXPECT_EQ(cit->second, 10);
+  map.erase(map.begin());
+  EXPECT_EQ(map.erase(3), 1);
+  EXPECT_EQ(map.erase(3), 0);
+  ExpectSame(map, {{2, 21}});
+}
+
+TEST(FlatMap, RangeInsertMatchesStdMap) {
+  std::mt19937 gen(11);
+  std::uniform_int_distribution<int> dist(0, 400);
+  s21::flat_map<int, int> map;
+  std::map<int, int> expected;
+  for (int round = 0; round < 20; ++round) {
+    std::vector<std::pair<int, int>> batch(
+        static_cast<std::size_t>(dist(gen) % 64));
+    for (auto &[key, value] : batch) {
+      key = dist(gen);
+      value = dist(gen);
+    }
+    map.insert(batch.begin(), batch.end());
+    expected.insert(batch.begin(), batch.end());
+    ExpectSame(map, expected);
+  }
+}
+
+TEST(FlatMap, RangeInsertPastTheEnd) {
+  s21::flat_map<int, int> map{{1, 1}, {2, 2}};
+  map.insert({{4, 4}, {3, 3}, {4, 5}, {2, 9}});
+  ExpectSame(map, {{1, 1}, {2, 2}, {3, 3}, {4, 4}});
+}
+
+TEST(FlatMap, SortedUnique) {
+  s21::flat_map<int, std::string> map(s21::sorted_unique, {1, 2, 5},
+                                      {"a", "b", "e"});
+  EXPECT_EQ(map.at(5), "e");
+  EXPECT_EQ(map.lower_bound(3)->first, 5);
+  EXPECT_EQ(map.upper_bound(1)->first, 2);
+  EXPECT_THROW((s21::flat_map<int, int>(s21::sorted_unique, {1, 2}, {1})),
+               std::invalid_argument);
+}
+
+TEST(FlatMap, HeterogeneousLookup) {
+  s21::flat_map<std::string, int, std::less<>> map{{"b", 2}, {"a", 1}};
+  std::string_view key = "b";
+  EXPECT_EQ(map.find(key)->second, 2);
+  EXPECT_EQ(map.at(key), 2);
+  EXPECT_TRUE(map.contains("a"));
+  EXPECT_EQ(map.count(std::string_view("c")), 0);
+  auto [first, last] = map.equal_range(key);
+  EXPECT_EQ(last - first, 1);
+  EXPECT_EQ(map.erase(key), 1);
+  EXPECT_EQ(map.erase(std::string_view("c")), 0);
+  ASSERT_EQ(map.size(), 1);
+  EXPECT_EQ(map.begin()->first, "a");
+}
+
+TEST(FlatMap, Swap) {
+  s21::flat_map<int, int> a{{1, 1}};
+  s21::flat_map<int, int> b{{2, 2}, {3, 3}};
+  a.swap(b);
+  ExpectSame(a, {{2, 2}, {3, 3}});
+  ExpectSame(b, {{1, 1}});
+}
+
+TEST(FlatMap, RangeInsertThrowingValueKeepsMap) {
+  s21::flat_map<int, Fragile> map;
+  for (int key = 0; key < 100; key += 2) map.try_emplace(key, key);
+  std::vector<std::pair<int, Fragile>> more;
+  for (int key = 1; key < 100; key += 2) more.emplace_back(key, -key);
+  // Appending copies 50 values, the merge throws halfway through
+  for (int budget : {10, 50, 75, 140}) {
+    Fragile::copies_left = budget;
+    EXPECT_THROW(map.insert(more.begin(), more.end()), std::runtime_error);
+    Fragile::copies_left = -1;
+    ASSERT_EQ(map.size(), 50);
+    for (int key = 0; key < 100; key += 2) {
+      ASSERT_TRUE(map.contains(key));
+      EXPECT_EQ(map.at(key).value, key);
+    }
+    EXPECT_FALSE(map.contains(1));
+  }
+  map.insert(more.begin(), more.end());
+  ASSERT_EQ(map.size(), 100);
+  EXPECT_EQ(map.at(99).value, -99);
+  EXPECT_EQ(map.at(98).value, 98);
+}
+
+TEST(FlatMap, RangeInsertThrowingMoveOnlyClearsMap) {
+  s21::flat_map<int, Stiff> map;
+  map.reserve(100);
+  for (int key = 50; key < 100; key += 2) map.try_emplace(key, key);
+  std::vector<std::pair<int, int>> above;
+  for (int key = 199; key > 100; key -= 2) above.emplace_back(key, -key);
+  // Appending moves each value once. Then only the appended pairs move,
+  // the map stays as it was
+  Stiff::moves_left = 60;
+  EXPECT_THROW(map.insert(above.begin(), above.end()), std::runtime_error);
+  Stiff::moves_left = -1;
+  ASSERT_EQ(map.size(), 25);
+  EXPECT_EQ(map.at(98).value, 98);
+  std::vector<std::pair<int, int>> between;
+  for (int key = 51; key < 100; key += 2) between.emplace_back(key, -key);
+  // The merge moves old pairs too, and can't put back the ones it lost
+  Stiff::moves_left = 35;
+  EXPECT_THROW(map.insert(between.begin(), between.end()),
+               std::runtime_error);
+  Stiff::moves_left = -1;
+  EXPECT_TRUE(map.empty());
+  map.insert(between.begin(), between.end());
+  ASSERT_EQ(map.size(), 25);
+  EXPECT_EQ(map.at(51).value, -51);
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "flat_set.h"
+
+namespace {
+
+template <class Set>
+void ExpectSame(const Set &set, const std::set<int> &expected) {
+  ASSERT_EQ(set.size(), expected.size());
+  EXPECT_TRUE(std::equal(set.begin(), set.end(), expected.begin()));
+}
+
+}  // namespace
+
+TEST(BranchlessSearch, MatchesStd) {
+  std::vector<int> values{1, 3, 3, 3, 5, 8, 8, 13};
+  std::less<int> less;
+  for (std::size_t size = 0; size <= values.size(); ++size) {
+    for (int key = 0; key <= 14; ++key) {
+      const int *first = values.data();
+      EXPECT_EQ(s21::detail::BranchlessLowerBound(first, size, key, less),
+                std::lower_bound(first, first + size, key));
+      EXPECT_EQ(s21::detail::BranchlessUpperBound(first, size, key, less),
+                std::upper_bound(first, first + size, key));
+    }
+  }
+}
+
+TEST(FlatSet, InsertFindErase) {
+  s21::flat_set<int> set;
+  EXPECT_TRUE(set.insert(5).second);
+  EXPECT_TRUE(set.insert(1).second);
+  EXPECT_FALSE(set.insert(5).second);
+  EXPECT_TRUE(set.emplace(3).second);
+  ExpectSame(set, {1, 3, 5});
+  EXPECT_EQ(*set.find(3), 3);
+  EXPECT_EQ(set.find(4), set.end());
+  EXPECT_TRUE(set.contains(1));
+  EXPECT_EQ(set.count(2), 0);
+  EXPECT_EQ(*set.lower_bound(2), 3);
+  EXPECT_EQ(*set.upper_bound(3), 5);
+  EXPECT_EQ(set.erase(3), 1);
+  EXPECT_EQ(set.erase(3), 0);
+  set.erase(set.begin());
+  ExpectSame(set, {5});
+}
+
+TEST(FlatSet, RangeInsertMatchesStdSet) {
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> dist(0, 500);
+  s21::flat_set<int> set;
+  std::set<int> expected;
+  for (int round = 0; round < 20; ++round) {
+    std::vector<int> batch(static_cast<std::size_t>(dist(gen) % 64));
+    for (int &x : batch) x = dist(gen);
+    set.insert(batch.begin(), batch.end());
+    expected.insert(batch.begin(), batch.end());
+    ExpectSame(set, expected);
+  }
+}
+
+TEST(FlatSet, RangeInsertPastTheEnd) {
+  s21::flat_set<int> set{1, 2, 3};
+  set.insert({5, 3, 4, 4});
+  ExpectSame(set, {1, 2, 3, 4, 5});
+  set.insert({9, 7});
+  ExpectSame(set, {1, 2, 3, 4, 5, 7, 9});
+}
+
+TEST(FlatSet, RangeInsertKeepsExistingKey) {
+  // Equivalent under the comparison, told apart by the second character
+  auto by_first = [](const std::string &a, const std::string &b) {
+    return a[0] < b[0];
+  };
+  s21::flat_set<std::string, decltype(by_first)> set({"a1", "c1"}, by_first);
+  set.insert({"c2", "b1", "b2", "a2"});
+  ASSERT_EQ(set.size(), 3);
+  EXPECT_EQ(set.sequence()[0], "a1");
+  EXPECT_EQ(set.sequence()[1], "b1");
+  EXPECT_EQ(set.sequence()[2], "c1");
+}
+
+TEST(FlatSet, SortedUnique) {
+  s21::vector<int> keys{1, 4, 9};
+  s21::flat_set<int> set(s21::sorted_unique, std::move(keys));
+  ExpectSame(set, {1, 4, 9});
+  std::vector<int> more{2, 9, 10};
+  set.insert(s21::sorted_unique, more.begin(), more.end());
+  ExpectSame(set, {1, 2, 4, 9, 10});
+  s21::vector<int> back = std::move(set).extract();
+  EXPECT_EQ(back.size(), 5);
+  EXPECT_TRUE(set.empty());
+#if S21_VECTOR_HARDENED
+  EXPECT_DEATH((s21::flat_set<int>(s21::sorted_unique, {2, 1})),
+               "aren't sorted and unique");
+#endif
+}
+
+TEST(FlatSet, HeterogeneousLookup) {
+  s21::flat_set<std::string, std::less<>> set{"apple", "kiwi", "pear"};
+  std::string_view key = "kiwi";
+  EXPECT_NE(set.find(key), set.end());
+  EXPECT_TRUE(set.contains(std::string_view("pear")));
+  EXPECT_FALSE(set.contains("plum"));
+  EXPECT_EQ(set.count(key), 1);
+  auto [first, last] = set.equal_range(std::string_view("k"));
+  EXPECT_EQ(first, last);
+  EXPECT_EQ(*first, "kiwi");
+  EXPECT_EQ(set.erase(key), 1);
+  EXPECT_EQ(set.size(), 2);
+}
+
+TEST(FlatSet, CustomOrder) {
+  s21::flat_set<int, std::greater<int>> set{1, 5, 3};
+  EXPECT_EQ(*set.begin(), 5);
+  EXPECT_EQ(*set.rbegin(), 1);
+  EXPECT_EQ(*set.lower_bound(4), 3);
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "growth_policy.h"
+#include "vector.h"
+
+TEST(GrowthPolicy, Doubling) {
+  EXPECT_EQ(s21::growth::doubling::next_capacity(0, 1, 4), 1);
+  EXPECT_EQ(s21::growth::doubling::next_capacity(3, 4, 4), 6);
+  EXPECT_EQ(s21::growth::doubling::next_capacity(3, 10, 4), 10);
+}
+
+TEST(GrowthPolicy, OneAndAHalf) {
+  EXPECT_EQ(s21::growth::one_and_a_half::next_capacity(0, 1, 4), 1);
+  EXPECT_EQ(s21::growth::one_and_a_half::next_capacity(1, 2, 4), 2);
+  EXPECT_EQ(s21::growth::one_and_a_half::next_capacity(10, 11, 4), 15);
+}
+
+TEST(GrowthPolicy, SizeClassRounding) {
+  using s21::growth::size_class;
+  EXPECT_EQ(size_class::round_bytes(1), 16);
+  EXPECT_EQ(size_class::round_bytes(100), 112);
+  EXPECT_EQ(size_class::round_bytes(129), 160);
+  EXPECT_EQ(size_class::round_bytes(4097), 5120);
+  EXPECT_EQ(size_class::round_bytes(5120), 5120);
+  // 15 ints need 60 bytes, the 64 byte class holds 16
+  EXPECT_EQ(size_class::next_capacity(10, 11, sizeof(int)), 16);
+  // Elements bigger than a class step still get at least what was asked
+  EXPECT_GE(size_class::next_capacity(3, 4, 1000), 4);
+}
+
+TEST(GrowthPolicy, PageGranular) {
+  using page = s21::growth::page_granular<4096>;
+  EXPECT_EQ(page::next_capacity(4, 5, sizeof(int)), 8);
+  std::size_t capacity = page::next_capacity(2000, 2001, sizeof(int));
+  EXPECT_EQ(capacity * sizeof(int) % 4096, 0);
+  EXPECT_GE(capacity, 3000);
+}
+
+TEST(GrowthPolicy, CacheLinePadded) {
+  using padded = s21::growth::cache_line_padded<>;
+  // 2 doubles are 16 bytes, the line holds 8
+  EXPECT_EQ(padded::next_capacity(1, 2, sizeof(double)), 8);
+  EXPECT_EQ(padded::next_capacity(8, 9, sizeof(double)), 16);
+  // 24 byte elements: 6 take 144 bytes, 192 hold 8
+  EXPECT_EQ(padded::next_capacity(3, 4, 24), 8);
+  EXPECT_EQ(padded::next_capacity(0, 1, 100), 1);
+  using page = s21::growth::cache_line_padded<s21::growth::one_and_a_half,
+                                              4096>;
+  EXPECT_EQ(page::next_capacity(10, 11, 1), 4096);
+}
+
+TEST(GrowthPolicy, PowerOfTwo) {
+  using pow2 = s21::growth::power_of_two;
+  EXPECT_EQ(pow2::next_capacity(0, 1, sizeof(int)), 4);
+  EXPECT_EQ(pow2::next_capacity(4, 5, sizeof(int)), 8);
+  // 100 ints need 400 bytes, the 512 byte class holds 128
+  EXPECT_EQ(pow2::next_capacity(10, 100, sizeof(int)), 128);
+  EXPECT_EQ(pow2::next_capacity(2, 3, 24), 5);
+  EXPECT_EQ(pow2::next_capacity(0, 1, 100), 1);
+}
+
+template <class Policy>
+class VectorGrowth : public ::testing::Test {};
+
+using Policies =
+    ::testing::Types<s21::growth::doubling, s21::growth::one_and_a_half,
+                     s21::growth::size_class, s21::growth::page_granular<>,
+                     s21::growth::power_of_two>;
+TYPED_TEST_SUITE(VectorGrowth, Policies);
+
+TYPED_TEST(VectorGrowth, PushBackAndInsert) {
+  s21::vector<std::string, std::allocator<std::string>, TypeParam> v;
+  for (int i = 0; i < 1000; ++i) {
+    v.push_back(std::to_string(i));
+    EXPECT_GE(v.capacity(), v.size());
+  }
+  v.insert(v.begin() + 500, 100, "x");
+  ASSERT_EQ(v.size(), 1100);
+  EXPECT_EQ(v[499], "499");
+  EXPECT_EQ(v[500], "x");
+  EXPECT_EQ(v[600], "500");
+}
+
+TYPED_TEST(VectorGrowth, ReserveExactAndAtLeast) {
+  s21::vector<int, std::allocator<int>, TypeParam> v;
+  v.reserve_exact(10);
+  EXPECT_EQ(v.capacity(), 10);
+  v.reserve_at_least(11);
+  EXPECT_GE(v.capacity(), 11);
+  v.reserve_at_least(5);
+  EXPECT_GE(v.capacity(), 11);
+}
+
+TEST(VectorGrowthPolicy, OneAndAHalfCapacities) {
+  s21::vector<int, std::allocator<int>, s21::growth::one_and_a_half> v;
+  std::size_t expected[] = {1, 2, 3, 4, 6, 9, 13, 19, 28};
+  std::size_t step = 0;
+  for (int i = 0; i < 28; ++i) {
+    v.push_back(i);
+    if (v.size() == v.capacity()) {
+      EXPECT_EQ(v.capacity(), expected[step++]);
+    }
+  }
+  EXPECT_EQ(step, 9);
+}
+
+TEST(VectorGrowthPolicy, SizeClassReserveAtLeast) {
+  s21::vector<int, std::allocator<int>, s21::growth::size_class> v;
+  // 11 ints need 44 bytes, the 48 byte class holds 12
+  v.reserve_at_least(11);
+  EXPECT_EQ(v.capacity(), 12);
+  v.reserve(17);
+  EXPECT_EQ(v.capacity(), 17);
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "huge_vector.h"
+
+namespace {
+
+// Elements per mapped block threshold of the default allocator
+constexpr std::size_t kMapped =
+    s21::mmap_allocator<std::uint64_t>::kThreshold / sizeof(std::uint64_t);
+
+}  // namespace
+
+TEST(HugeVector, GrowsAcrossThreshold) {
+  s21::huge_vector<std::uint64_t> v;
+  for (std::uint64_t i = 0; i < 4 * kMapped; ++i) v.push_back(i);
+  ASSERT_EQ(v.size(), 4 * kMapped);
+  EXPECT_GE(v.capacity(), v.size());
+  for (std::uint64_t i = 0; i < v.size(); ++i) ASSERT_EQ(v[i], i);
+}
+
+TEST(HugeVector, ReserveKeepsContents) {
+  s21::huge_vector<std::uint64_t> v(kMapped, 7);
+  v.reserve(16 * kMapped);
+  EXPECT_EQ(v.capacity(), 16 * kMapped);
+  ASSERT_EQ(v.size(), kMapped);
+  EXPECT_EQ(v.front(), 7);
+  EXPECT_EQ(v.back(), 7);
+}
+
+TEST(HugeVector, ShrinkToFitBelowThreshold) {
+  s21::huge_vector<std::uint64_t> v(2 * kMapped, 3);
+  while (v.size() > 100) v.pop_back();
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 100);
+  for (std::uint64_t value : v) ASSERT_EQ(value, 3);
+}
+
+TEST(HugeVector, ReleasePagesKeepsCapacity) {
+  s21::huge_vector<std::uint64_t> v(4 * kMapped, 1);
+  const std::size_t capacity = v.capacity();
+  v.erase(v.begin() + 100, v.end());
+  v.release_pages();
+  EXPECT_EQ(v.capacity(), capacity);
+  for (std::uint64_t value : v) ASSERT_EQ(value, 1);
+  v.clear();
+  v.release_pages();
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(v.capacity(), capacity);
+  v.push_back(5);
+  EXPECT_EQ(v[0], 5);
+}
+
+TEST(HugeVector, CopyAndMove) {
+  s21::huge_vector<std::uint64_t> v(2 * kMapped, 9);
+  s21::huge_vector<std::uint64_t> copy(v);
+  s21::huge_vector<std::uint64_t> moved(std::move(v));
+  EXPECT_EQ(copy.size(), 2 * kMapped);
+  EXPECT_EQ(moved.size(), 2 * kMapped);
+  EXPECT_EQ(copy.back(), 9);
+  EXPECT_EQ(moved.front(), 9);
+}
+
+TEST(MmapAllocator, ReallocateSmallAndMapped) {
+  s21::mmap_allocator<int, false, 4096> alloc;
+  int *p = alloc.allocate(16);
+  for (int i = 0; i < 16; ++i) p[i] = i;
+  p = alloc.reallocate(p, 16, 4096);
+  p[4095] = -1;
+  p = alloc.reallocate(p, 4096, 8192);
+  for (int i = 0; i < 16; ++i) ASSERT_EQ(p[i], i);
+  EXPECT_EQ(p[4095], -1);
+  p = alloc.reallocate(p, 8192, 8);
+  for (int i = 0; i < 8; ++i) ASSERT_EQ(p[i], i);
+  alloc.deallocate(p, 8);
+}
+
+TEST(MmapAllocator, DiscardZeroesPages) {
+  s21::mmap_allocator<char, false, 4096> alloc;
+  char *p = alloc.allocate(1 << 16);
+  for (int i = 0; i < (1 << 16); ++i) p[i] = 'x';
+  alloc.discard(p, 1 << 16);
+  EXPECT_EQ(p[0], 0);
+  EXPECT_EQ(p[(1 << 16) - 1], 0);
+  alloc.deallocate(p, 1 << 16);
+}
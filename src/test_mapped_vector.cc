@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+#include <sys/stat.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "mapped_vector.h"
+
+namespace {
+
+struct Record {
+  std::uint64_t id;
+  double value;
+  std::uint32_t flags;
+};
+
+// A fresh file name per test, removed again at the end of the test
+class MappedVector : public ::testing::Test {
+ protected:
+  std::string path_;
+
+  void SetUp() override {
+    path_ = ::testing::TempDir() + "s21_mapped_vector_" +
+            ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    std::remove(path_.c_str());
+  }
+
+  void TearDown() override { std::remove(path_.c_str()); }
+
+  off_t FileSize() const {
+    struct stat st;
+    return stat(path_.c_str(), &st) == 0 ? st.st_size : -1;
+  }
+};
+
+}  // namespace
+
+TEST_F(MappedVector, CreatesEmptyFile) {
+  s21::mapped_vector<int> v(path_);
+  EXPECT_TRUE(v.is_open());
+  EXPECT_FALSE(v.read_only());
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(v.capacity(), 0);
+  EXPECT_EQ(v.begin(), v.end());
+  EXPECT_EQ(FileSize(), 64);
+}
+
+TEST_F(MappedVector, ContentsSurviveReopen) {
+  {
+    s21::mapped_vector<Record> v(path_);
+    for (std::uint64_t i = 0; i < 10000; ++i)
+      v.push_back(Record{i, i * 0.5, static_cast<std::uint32_t>(i % 7)});
+    v.flush();
+  }
+  s21::mapped_vector<Record> v(path_, s21::map_mode::read_only);
+  EXPECT_TRUE(v.read_only());
+  ASSERT_EQ(v.size(), 10000);
+  EXPECT_GE(v.capacity(), v.size());
+  for (std::uint64_t i = 0; i < v.size(); ++i) {
+    ASSERT_EQ(v[i].id, i);
+    ASSERT_EQ(v[i].value, i * 0.5);
+    ASSERT_EQ(v[i].flags, i % 7);
+  }
+  EXPECT_EQ(v.back().id, 9999);
+  EXPECT_THROW(v.at(10000), std::out_of_range);
+}
+
+TEST_F(MappedVector, ReadOnlyRejectsChanges) {
+  { s21::mapped_vector<int> v(path_); }
+  s21::mapped_vector<int> v(path_, s21::map_mode::read_only);
+  EXPECT_THROW(v.push_back(1), std::logic_error);
+  EXPECT_THROW(v.reserve(100), std::logic_error);
+  EXPECT_THROW(v.clear(), std::logic_error);
+  s21::mapped_vector<int> closed;
+  EXPECT_FALSE(closed.is_open());
+  EXPECT_THROW(closed.push_back(1), std::logic_error);
+}
+
+TEST_F(MappedVector, MissingFile) {
+  EXPECT_THROW(s21::mapped_vector<int>(path_, s21::map_mode::read_only),
+               std::system_error);
+}
+
+TEST_F(MappedVector, RejectsForeignFiles) {
+  {
+    std::ofstream out(path_, std::ios::binary);
+    out << std::string(100, 'x');
+  }
+  EXPECT_THROW(s21::mapped_vector<int>{path_}, std::runtime_error);
+  {
+    std::ofstream out(path_, std::ios::binary);
+    out << "short";
+  }
+  EXPECT_THROW(s21::mapped_vector<int>{path_}, std::runtime_error);
+}
+
+TEST_F(MappedVector, RejectsOtherElementType) {
+  {
+    s21::mapped_vector<std::uint32_t> v(path_);
+    v.push_back(1);
+  }
+  EXPECT_THROW(s21::mapped_vector<std::uint64_t>{path_}, std::runtime_error);
+  EXPECT_NO_THROW(s21::mapped_vector<std::int32_t>{path_});
+}
+
+TEST_F(MappedVector, RejectsTruncatedFile) {
+  {
+    s21::mapped_vector<std::uint64_t> v(path_);
+    v.resize(1000, 3);
+  }
+  ASSERT_EQ(truncate(path_.c_str(), 64 + 100 * 8), 0);
+  EXPECT_THROW(s21::mapped_vector<std::uint64_t>{path_}, std::runtime_error);
+}
+
+TEST_F(MappedVector, TruncateMode) {
+  {
+    s21::mapped_vector<int> v(path_);
+    v.append({1, 2, 3});
+  }
+  s21::mapped_vector<int> v(path_, s21::map_mode::truncate);
+  EXPECT_TRUE(v.empty());
+}
+
+TEST_F(MappedVector, ReserveAndShrinkResizeTheFile) {
+  s21::mapped_vector<std::uint64_t> v(path_);
+  v.reserve(1000);
+  EXPECT_EQ(v.capacity(), 1000);
+  EXPECT_EQ(FileSize(), 64 + 1000 * 8);
+  v.resize(10, 7);
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 10);
+  EXPECT_EQ(FileSize(), 64 + 10 * 8);
+  for (std::uint64_t x : v) EXPECT_EQ(x, 7);
+}
+
+TEST_F(MappedVector, Modifiers) {
+  s21::mapped_vector<int> v(path_);
+  v.append({1, 2, 3});
+  EXPECT_EQ(v.emplace_back(4), 4);
+  v.push_back(v[0]);
+  EXPECT_EQ(v.size(), 5);
+  EXPECT_EQ(v.back(), 1);
+  v.pop_back();
+  v.resize(2);
+  EXPECT_EQ(v.size(), 2);
+  EXPECT_EQ(v.front(), 1);
+  v.clear();
+  EXPECT_TRUE(v.empty());
+  EXPECT_THROW(v.pop_back(), std::length_error);
+}
+
+TEST_F(MappedVector, MoveAndSwap) {
+  s21::mapped_vector<int> v(path_);
+  v.append({1, 2, 3});
+  s21::mapped_vector<int> moved(std::move(v));
+  EXPECT_FALSE(v.is_open());
+  EXPECT_EQ(moved.size(), 3);
+  s21::mapped_vector<int> other;
+  other = std::move(moved);
+  EXPECT_EQ(other[2], 3);
+  other.push_back(4);
+  other.flush(true);
+  EXPECT_EQ(other.size(), 4);
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "packed_vector.h"
+
+namespace {
+
+template <unsigned Bits>
+void RoundTrip() {
+  using Packed = s21::packed_vector<Bits>;
+  std::mt19937_64 gen(Bits);
+  Packed packed;
+  std::vector<typename Packed::value_type> expected;
+  for (int i = 0; i < 333; ++i) {
+    auto value = static_cast<typename Packed::value_type>(gen() &
+                                                          Packed::max_value);
+    packed.push_back(value);
+    expected.push_back(value);
+  }
+  ASSERT_EQ(packed.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i)
+    ASSERT_EQ(packed[i], expected[i]) << "Bits " << Bits << " at " << i;
+  // Overwrites keep the neighbours intact
+  for (std::size_t i = 0; i < expected.size(); i += 7) {
+    expected[i] = static_cast<typename Packed::value_type>(Packed::max_value -
+                                                           expected[i]);
+    packed.set(i, expected[i]);
+  }
+  std::vector<typename Packed::value_type> scanned(packed.begin(),
+                                                   packed.end());
+  EXPECT_EQ(scanned, expected);
+}
+
+}  // namespace
+
+TEST(PackedVector, RoundTripAllWidths) {
+  RoundTrip<1>();
+  RoundTrip<3>();
+  RoundTrip<7>();
+  RoundTrip<8>();
+  RoundTrip<13>();
+  RoundTrip<20>();
+  RoundTrip<32>();
+  RoundTrip<33>();
+  RoundTrip<63>();
+  RoundTrip<64>();
+}
+
+TEST(PackedVector, Memory) {
+  s21::packed_vector<20> packed(6400);
+  EXPECT_EQ(packed.size(), 6400);
+  EXPECT_GE(packed.capacity(), 6400);
+  EXPECT_EQ(sizeof(s21::packed_vector<20>::value_type), 4);
+  EXPECT_EQ(sizeof(s21::packed_vector<3>::value_type), 1);
+  EXPECT_EQ(s21::packed_vector<3>::max_value, 7);
+}
+
+TEST(PackedVector, Proxies) {
+  s21::packed_vector<5> packed{1, 2, 3};
+  packed[1] = 31;
+  packed[2] = packed[0];
+  EXPECT_EQ(packed[1], 31);
+  EXPECT_EQ(packed[2], 1);
+  EXPECT_EQ(packed.front(), 1);
+  EXPECT_EQ(packed.back(), 1);
+  EXPECT_THROW(packed.at(3), std::out_of_range);
+#if S21_VECTOR_HARDENED
+  EXPECT_DEATH(packed.set(0, 32), "doesn't fit");
+#endif
+}
+
+TEST(PackedVector, ResizeAndPop) {
+  s21::packed_vector<11> packed(100, 1000);
+  EXPECT_EQ(packed[99], 1000);
+  packed.resize(10);
+  packed.resize(20);
+  EXPECT_EQ(packed[9], 1000);
+  EXPECT_EQ(packed[10], 0);
+  EXPECT_EQ(packed[19], 0);
+  packed.pop_back();
+  packed.push_back(5);
+  EXPECT_EQ(packed[19], 5);
+  s21::packed_vector<11> other(20);
+  for (std::size_t i = 0; i < 20; ++i) other.set(i, packed[i]);
+  EXPECT_EQ(packed, other);
+  other.pop_back();
+  EXPECT_NE(packed, other);
+  packed.clear();
+  EXPECT_THROW(packed.pop_back(), std::length_error);
+}
+
+TEST(PackedVector, Unpack) {
+  s21::packed_vector<13> packed;
+  for (std::uint16_t i = 0; i < 200; ++i) packed.push_back(i * 37 % 8192);
+  std::uint16_t out[64];
+  packed.unpack(64, 64, out);
+  for (int i = 0; i < 64; ++i) EXPECT_EQ(out[i], (64 + i) * 37 % 8192);
+  packed.unpack(150, 50, out);
+  for (int i = 0; i < 50; ++i) EXPECT_EQ(out[i], (150 + i) * 37 % 8192);
+}
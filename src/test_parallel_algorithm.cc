@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <string>
+
+#include "parallel_algorithm.h"
+
+namespace {
+
+s21::vector<int> Random(std::size_t size, unsigned seed) {
+  std::mt19937 engine(seed);
+  std::uniform_int_distribution<int> value(-1000, 1000);
+  s21::vector<int> vec;
+  for (std::size_t i = 0; i < size; ++i) vec.push_back(value(engine));
+  return vec;
+}
+
+// Small chunks on a pool of its own, so every path splits into tasks
+class Parallel : public testing::Test {
+ protected:
+  s21::thread_pool pool_{3};
+  s21::parallel::policy policy_{&pool_, 100};
+};
+
+}  // namespace
+
+TEST_F(Parallel, ForEach) {
+  s21::vector<int> vec(10007, 1);
+  s21::parallel::for_each(policy_, vec.begin(), vec.end(),
+                          [](int &x) { x *= 3; });
+  EXPECT_TRUE(std::all_of(vec.begin(), vec.end(),
+                          [](int x) { return x == 3; }));
+}
+
+TEST_F(Parallel, TransformInPlaceAndInto) {
+  s21::vector<int> vec = Random(10007, 1);
+  s21::vector<std::int64_t> out(vec.size());
+  auto end = s21::parallel::transform(
+      policy_, vec.begin(), vec.end(), out.begin(),
+      [](int x) { return std::int64_t{x} * x; });
+  EXPECT_EQ(end, out.end());
+  for (std::size_t i = 0; i < vec.size(); ++i)
+    ASSERT_EQ(out[i], std::int64_t{vec[i]} * vec[i]);
+  s21::vector<int> negated = vec;
+  s21::parallel::transform(policy_, negated.begin(), negated.end(),
+                           negated.begin(), [](int x) { return -x; });
+  for (std::size_t i = 0; i < vec.size(); ++i) ASSERT_EQ(negated[i], -vec[i]);
+}
+
+TEST_F(Parallel, Reduce) {
+  s21::vector<int> vec = Random(100003, 2);
+  std::int64_t expected =
+      std::accumulate(vec.begin(), vec.end(), std::int64_t{5});
+  EXPECT_EQ(s21::parallel::reduce(policy_, vec.begin(), vec.end(),
+                                  std::int64_t{5}),
+            expected);
+  EXPECT_EQ(s21::parallel::reduce(vec.begin(), vec.end(), std::int64_t{5}),
+            expected);
+  EXPECT_EQ(s21::parallel::reduce(policy_, vec.begin(), vec.begin(), 7), 7);
+  int max = s21::parallel::reduce(
+      policy_, vec.begin(), vec.end(), -1000000,
+      [](int a, int b) { return std::max(a, b); });
+  EXPECT_EQ(max, *std::max_element(vec.begin(), vec.end()));
+}
+
+TEST_F(Parallel, DeterministicReduceIgnoresThreads) {
+  s21::vector<double> vec;
+  std::mt19937 engine(3);
+  std::uniform_real_distribution<double> value(-1e6, 1e6);
+  for (int i = 0; i < 200000; ++i) vec.push_back(value(engine));
+  s21::thread_pool single(0);
+  s21::parallel::policy one{&single, 0, true};
+  s21::parallel::policy many{&pool_, 0, true};
+  double expected = s21::parallel::reduce(one, vec.begin(), vec.end(), 0.0);
+  for (int run = 0; run < 5; ++run)
+    EXPECT_EQ(s21::parallel::reduce(many, vec.begin(), vec.end(), 0.0),
+              expected);
+}
+
+TEST_F(Parallel, Sort) {
+  for (std::size_t size : {0, 1, 99, 100, 101, 1000, 54321}) {
+    s21::vector<int> vec = Random(size, 4);
+    s21::vector<int> expected = vec;
+    std::sort(expected.begin(), expected.end());
+    s21::parallel::sort(policy_, vec.begin(), vec.end());
+    ASSERT_TRUE(std::equal(vec.begin(), vec.end(), expected.begin(),
+                           expected.end()));
+  }
+}
+
+TEST_F(Parallel, SortWithSmallAndLargeGrain) {
+  for (std::size_t grain : {1, 2, 3, 5000}) {
+    s21::parallel::policy p{&pool_, grain};
+    for (std::size_t size : {0, 1, 2, 1000}) {
+      s21::vector<int> vec = Random(size, 7);
+      s21::vector<int> expected = vec;
+      std::sort(expected.begin(), expected.end());
+      s21::parallel::sort(p, vec.begin(), vec.end());
+      ASSERT_TRUE(std::equal(vec.begin(), vec.end(), expected.begin(),
+                             expected.end()))
+          << "grain " << grain << ", size " << size;
+    }
+  }
+}
+
+TEST_F(Parallel, SortWithComparatorAndStrings) {
+  s21::vector<std::string> vec;
+  for (int x : Random(5000, 5)) vec.push_back(std::to_string(x));
+  s21::vector<std::string> expected = vec;
+  std::sort(expected.begin(), expected.end(), std::greater<>());
+  s21::parallel::sort(policy_, vec.begin(), vec.end(), std::greater<>());
+  EXPECT_TRUE(std::equal(vec.begin(), vec.end(), expected.begin()));
+}
+
+TEST_F(Parallel, StablePartition) {
+  s21::vector<int> vec = Random(10007, 6);
+  s21::vector<int> expected = vec;
+  auto even = [](int x) { return x % 2 == 0; };
+  auto expected_middle =
+      std::stable_partition(expected.begin(), expected.end(), even);
+  auto middle =
+      s21::parallel::stable_partition(policy_, vec.begin(), vec.end(), even);
+  EXPECT_EQ(middle - vec.begin(), expected_middle - expected.begin());
+  EXPECT_TRUE(std::equal(vec.begin(), vec.end(), expected.begin()));
+}
+
+TEST_F(Parallel, ExceptionsReachTheCaller) {
+  s21::vector<int> vec(10000, 1);
+  vec[7777] = 0;
+  EXPECT_THROW(s21::parallel::for_each(policy_, vec.begin(), vec.end(),
+                                       [](int x) {
+                                         if (!x) throw std::domain_error("0");
+                                       }),
+               std::domain_error);
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "recycling_allocator.h"
+
+namespace {
+
+using pool = s21::recycling_pool;
+
+std::size_t UpstreamAllocations() {
+  return pool::stats().upstream_allocations;
+}
+
+}  // namespace
+
+TEST(RecyclingPool, ReusesBlockOfSameClass) {
+  pool::trim();
+  std::size_t before = UpstreamAllocations();
+  const int *first = nullptr;
+  {
+    s21::recycling_vector<int> v;
+    v.reserve(100);
+    first = v.data();
+  }
+  // 120 ints round up to the same 512 byte class as 100
+  s21::recycling_vector<int> v;
+  v.reserve(120);
+  EXPECT_EQ(v.data(), first);
+  EXPECT_EQ(v.capacity(), 120);
+  EXPECT_EQ(UpstreamAllocations(), before + 1);
+}
+
+TEST(RecyclingPool, GrowthFillsClass) {
+  s21::recycling_vector<int> v;
+  v.push_back(1);
+  EXPECT_EQ(v.capacity(), 4);
+  for (int i = 0; i < 100; ++i) v.push_back(i);
+  EXPECT_EQ(v.capacity(), 128);
+  EXPECT_EQ(v[100], 99);
+}
+
+TEST(RecyclingPool, ReallocateInsideClassKeepsBlock) {
+  s21::recycling_allocator<int> alloc;
+  int *block = alloc.allocate(5);
+  for (int i = 0; i < 5; ++i) block[i] = i;
+  EXPECT_EQ(alloc.reallocate(block, 5, 8), block);
+  int *moved = alloc.reallocate(block, 8, 9);
+  EXPECT_EQ(moved[4], 4);
+  alloc.deallocate(moved, 9);
+}
+
+TEST(RecyclingPool, LargeBlocksBypassPool) {
+  pool::trim();
+  auto before = pool::stats();
+  {
+    s21::recycling_vector<char> v;
+    v.reserve(pool::max_block + 1);
+  }
+  auto after = pool::stats();
+  EXPECT_EQ(after.upstream_allocations, before.upstream_allocations + 1);
+  EXPECT_EQ(after.upstream_deallocations, before.upstream_deallocations + 1);
+  EXPECT_EQ(after.upstream_bytes, before.upstream_bytes);
+  EXPECT_GE(after.peak_upstream_bytes, pool::max_block + 1);
+}
+
+TEST(RecyclingPool, CachesAreCapped) {
+  pool::trim();
+  auto before = pool::stats();
+  {
+    std::vector<s21::recycling_vector<int>> many(2000);
+    for (auto &v : many) v.reserve(4);
+  }
+  auto after = pool::stats();
+  EXPECT_EQ(after.upstream_allocations, before.upstream_allocations + 2000);
+  // Only the thread cache and the shared list of the class stay
+  EXPECT_GT(after.upstream_deallocations, before.upstream_deallocations);
+  EXPECT_LE(after.upstream_bytes - before.upstream_bytes, 16 * 9 * 64);
+  pool::trim();
+  EXPECT_EQ(pool::stats().upstream_bytes, before.upstream_bytes);
+}
+
+TEST(RecyclingPool, BlocksFreedOnOtherThread) {
+  pool::trim();
+  std::size_t before = UpstreamAllocations();
+  std::vector<s21::recycling_vector<std::string>> made(32);
+  for (auto &v : made) v.assign(40, "payload long enough for the heap");
+  std::thread consumer([taken = std::move(made)]() mutable {
+    taken.clear();
+  });
+  consumer.join();
+  std::size_t produced = UpstreamAllocations() - before;
+  // The consumer's cache moved to the shared list when it exited
+  std::vector<s21::recycling_vector<std::string>> again(32);
+  for (auto &v : again) v.reserve(40);
+  EXPECT_EQ(UpstreamAllocations() - before, produced);
+}
+
+TEST(RecyclingPool, NonTrivialElements) {
+  s21::recycling_vector<std::string> v;
+  for (int i = 0; i < 300; ++i) v.push_back(std::to_string(i));
+  v.insert(v.begin(), "first");
+  v.erase(v.begin() + 1, v.begin() + 101);
+  ASSERT_EQ(v.size(), 201);
+  EXPECT_EQ(v[0], "first");
+  EXPECT_EQ(v[1], "100");
+  EXPECT_EQ(v.back(), "299");
+}
@@ -1,8 +1,9 @@
 #include "gtest/gtest.h"
 
-int main() {
-  testing::InitGoogleTest();
-  if (RUN_ALL_TESTS()) {
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  int result = RUN_ALL_TESTS();
+  if (result) {
     std::cout << "Some tests have failed :(\n"
               << "Get back to work!"
               << "\n";
@@ -10,4 +11,5 @@ int main() {
     std::cout << "Great work!"
               << "\n";
   }
+  return result;
 }
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "segmented_vector.h"
+
+TEST(SegmentedVector, DefaultChunkSize) {
+  EXPECT_EQ(s21::default_chunk_size<char>(), 4096);
+  EXPECT_EQ(s21::default_chunk_size<int>(), 1024);
+  struct Big {
+    char bytes[3000];
+  };
+  EXPECT_EQ(s21::default_chunk_size<Big>(), 1);
+  EXPECT_EQ((s21::segmented_vector<int, 4>::chunk_size), 4);
+}
+
+TEST(SegmentedVector, PushBackKeepsAddresses) {
+  s21::segmented_vector<std::string, 4> v;
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(v.begin(), v.end());
+  v.push_back("first");
+  const std::string *first = &v[0];
+  for (int i = 1; i < 100; ++i) v.push_back(std::to_string(i));
+  EXPECT_EQ(&v[0], first);
+  EXPECT_EQ(v.size(), 100);
+  EXPECT_EQ(v.capacity(), 100);
+  EXPECT_EQ(v.chunk_count(), 25);
+  EXPECT_EQ(v.front(), "first");
+  EXPECT_EQ(v.back(), "99");
+  EXPECT_EQ(v.at(42), "42");
+  EXPECT_THROW(v.at(100), std::out_of_range);
+}
+
+TEST(SegmentedVector, PopBackKeepsChunks) {
+  s21::segmented_vector<int, 4> v{1, 2, 3, 4, 5};
+  EXPECT_EQ(v.capacity(), 8);
+  v.pop_back();
+  v.pop_back();
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(v.capacity(), 8);
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 4);
+  v.push_back(9);
+  v.push_back(10);
+  EXPECT_EQ(v[4], 10);
+  while (!v.empty()) v.pop_back();
+  EXPECT_THROW(v.pop_back(), std::length_error);
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 0);
+}
+
+TEST(SegmentedVector, IteratorsWalkChunks) {
+  for (std::size_t size : {0, 1, 3, 4, 5, 8, 13}) {
+    s21::segmented_vector<int, 4> v;
+    for (std::size_t i = 0; i < size; ++i) v.push_back(static_cast<int>(i));
+    EXPECT_EQ(static_cast<std::size_t>(v.end() - v.begin()), size);
+    EXPECT_EQ(static_cast<std::size_t>(std::distance(v.begin(), v.end())),
+              size);
+    int expected = 0;
+    for (int x : v) EXPECT_EQ(x, expected++);
+    if (size == 0) continue;
+    EXPECT_EQ(*(v.end() - 1), static_cast<int>(size - 1));
+    auto it = v.end();
+    --it;
+    EXPECT_EQ(*it, static_cast<int>(size - 1));
+    for (std::size_t i = 0; i < size; ++i) {
+      EXPECT_EQ(v.begin()[i], static_cast<int>(i));
+      EXPECT_EQ(*(v.end() - (size - i)), static_cast<int>(i));
+    }
+  }
+}
+
+TEST(SegmentedVector, WorksWithAlgorithms) {
+  s21::segmented_vector<int, 8> v;
+  for (int i = 100; i > 0; --i) v.push_back(i);
+  std::sort(v.begin(), v.end());
+  EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+  EXPECT_EQ(*std::lower_bound(v.begin(), v.end(), 50), 50);
+  const auto &cv = v;
+  s21::segmented_vector<int, 8>::const_iterator it = v.begin();
+  EXPECT_EQ(it, cv.begin());
+  EXPECT_EQ(std::accumulate(cv.begin(), cv.end(), 0), 5050);
+}
+
+TEST(SegmentedVector, ForEachChunk) {
+  s21::segmented_vector<int, 4> v;
+  for (int i = 0; i < 10; ++i) v.push_back(i);
+  std::vector<std::size_t> lengths;
+  int sum = 0;
+  v.for_each_chunk([&](const int *first, const int *last) {
+    lengths.push_back(last - first);
+    for (; first != last; ++first) sum += *first;
+  });
+  EXPECT_EQ(lengths, (std::vector<std::size_t>{4, 4, 2}));
+  EXPECT_EQ(sum, 45);
+}
+
+TEST(SegmentedVector, CopyMoveSwap) {
+  s21::segmented_vector<std::string, 2> a{"a", "b", "c"};
+  s21::segmented_vector<std::string, 2> b(a);
+  EXPECT_TRUE(std::equal(a.begin(), a.end(), b.begin(), b.end()));
+  s21::segmented_vector<std::string, 2> c(std::move(a));
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(c.size(), 3);
+  a = c;
+  EXPECT_EQ(a[2], "c");
+  s21::segmented_vector<std::string, 2> d{"x"};
+  d.swap(a);
+  EXPECT_EQ(d.size(), 3);
+  EXPECT_EQ(a.size(), 1);
+  a = std::move(d);
+  EXPECT_EQ(a.back(), "c");
+  s21::segmented_vector<std::string, 2> e(5, "e");
+  EXPECT_EQ(e[4], "e");
+}
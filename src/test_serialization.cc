@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "serialization.h"
+
+namespace {
+
+using Bytes = s21::vector<unsigned char>;
+
+struct Point {
+  std::int32_t x;
+  std::int32_t y;
+  bool operator==(const Point &other) const {
+    return x == other.x && y == other.y;
+  }
+};
+
+// Trivially copyable but not trivial
+struct Record {
+  std::int32_t id = -1;
+  double value = 0.5;
+  bool operator==(const Record &other) const {
+    return id == other.id && value == other.value;
+  }
+};
+
+enum class Color : std::uint16_t { red = 1, green = 0x0102 };
+
+// s21::vector has no operator==
+template <class T>
+bool Same(const s21::vector<T> &a, const s21::vector<T> &b);
+
+template <class T>
+bool Same(const T &a, const T &b) {
+  return a == b;
+}
+
+template <class T>
+bool Same(const s21::vector<T> &a, const s21::vector<T> &b) {
+  if (a.size() != b.size()) return false;
+  for (std::size_t i = 0; i < a.size(); ++i)
+    if (!Same(a[i], b[i])) return false;
+  return true;
+}
+
+template <class T>
+T RoundTrip(const T &value,
+            s21::serial::byte_order order = s21::serial::byte_order::native) {
+  Bytes bytes;
+  s21::serial::memory_sink sink(bytes);
+  s21::serial::writer out(sink, order);
+  out.write(value);
+  s21::serial::memory_source source(bytes);
+  s21::serial::reader in(source, order);
+  T result = in.template get<T>();
+  EXPECT_EQ(source.remaining(), 0);
+  return result;
+}
+
+}  // namespace
+
+TEST(Serialization, Scalars) {
+  EXPECT_EQ(RoundTrip(42), 42);
+  EXPECT_EQ(RoundTrip(-1.5), -1.5);
+  EXPECT_EQ(RoundTrip(Color::green), Color::green);
+  EXPECT_EQ(RoundTrip(Point{3, -4}), (Point{3, -4}));
+  EXPECT_EQ(RoundTrip(std::string("hello")), "hello");
+  EXPECT_EQ(RoundTrip(std::string()), "");
+}
+
+TEST(Serialization, TriviallyCopyableVector) {
+  s21::vector<std::uint64_t> v;
+  for (std::uint64_t i = 0; i < 100000; ++i) v.push_back(i * i);
+  EXPECT_TRUE(Same(RoundTrip(v), v));
+  s21::vector<Point> points{{1, 2}, {3, 4}};
+  EXPECT_TRUE(Same(RoundTrip(points), points));
+  EXPECT_TRUE(RoundTrip(s21::vector<int>()).empty());
+}
+
+TEST(Serialization, RecordsWithMemberInitializers) {
+  s21::vector<Record> records;
+  for (std::int32_t i = 0; i < 5000; ++i) records.push_back({i, i * 0.25});
+  EXPECT_TRUE(Same(RoundTrip(records), records));
+  EXPECT_EQ(RoundTrip(Record{7, 1.5}), (Record{7, 1.5}));
+}
+
+TEST(Serialization, NestedVectors) {
+  s21::vector<s21::vector<std::string>> table{
+      {"a", "bc"}, {}, {"", std::string(1000, 'x')}};
+  EXPECT_TRUE(Same(RoundTrip(table), table));
+  s21::vector<s21::vector<double>> grid{{1.0, 2.0}, {3.0}};
+  EXPECT_TRUE(Same(RoundTrip(grid), grid));
+}
+
+TEST(Serialization, Layout) {
+  Bytes bytes;
+  s21::serial::memory_sink sink(bytes);
+  s21::serial::writer out(sink, s21::serial::byte_order::big);
+  out.write(std::uint32_t{0x01020304});
+  out.write(std::string("ab"));
+  const Bytes expected{1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 2, 'a', 'b'};
+  EXPECT_TRUE(Same(bytes, expected));
+
+  bytes.clear();
+  s21::serial::writer little(sink, s21::serial::byte_order::little);
+  little.write(std::uint16_t{0x0102});
+  EXPECT_TRUE(Same(bytes, (Bytes{2, 1})));
+}
+
+TEST(Serialization, ForeignByteOrder) {
+  const auto other = s21::serial::byte_order::native ==
+                             s21::serial::byte_order::little
+                         ? s21::serial::byte_order::big
+                         : s21::serial::byte_order::little;
+  s21::vector<std::uint32_t> v;
+  for (std::uint32_t i = 0; i < 5000; ++i) v.push_back(i * 2654435761u);
+  EXPECT_TRUE(Same(RoundTrip(v, other), v));
+  s21::vector<double> d{0.5, -2.25, 1e300};
+  EXPECT_TRUE(Same(RoundTrip(d, other), d));
+  EXPECT_EQ(RoundTrip(Color::green, other), Color::green);
+
+  Bytes bytes;
+  s21::serial::memory_sink sink(bytes);
+  s21::serial::writer(sink, other).write(std::uint32_t{7});
+  s21::serial::memory_source source(bytes);
+  EXPECT_NE(s21::serial::reader(source).get<std::uint32_t>(), 7);
+}
+
+TEST(Serialization, Chunks) {
+  s21::vector<int> v;
+  for (int i = 0; i < 1000; ++i) v.push_back(i);
+  Bytes bytes;
+  s21::serial::memory_sink sink(bytes);
+  s21::serial::writer out(sink);
+  out.write_chunked(v, 300);
+  out.write_chunk(v.data(), 0);
+  out.write_chunk(v.data(), 2);
+  out.end_chunks();
+
+  s21::serial::memory_source source(bytes);
+  s21::serial::reader in(source);
+  s21::vector<int> result{-1};
+  in.read_chunks(result);
+  ASSERT_EQ(result.size(), 1001);
+  EXPECT_EQ(result[0], -1);
+  EXPECT_EQ(result[1000], 999);
+  in.read_chunks(result);
+  EXPECT_EQ(result.size(), 1003);
+  EXPECT_EQ(result.back(), 1);
+  EXPECT_EQ(source.remaining(), 0);
+}
+
+TEST(Serialization, TruncatedInput) {
+  Bytes bytes;
+  s21::serial::memory_sink sink(bytes);
+  s21::serial::writer(sink).write(s21::vector<int>{1, 2, 3});
+  bytes.pop_back();
+  s21::serial::memory_source source(bytes);
+  s21::vector<int> v;
+  EXPECT_THROW(s21::serial::reader(source).read(v), s21::serial::error);
+
+  // A size far beyond the input fails on the input, not on memory
+  Bytes huge;
+  s21::serial::memory_sink huge_sink(huge);
+  s21::serial::writer(huge_sink).write(std::uint64_t{1} << 40);
+  s21::serial::memory_source huge_source(huge);
+  EXPECT_THROW(s21::serial::reader(huge_source).read(v), s21::serial::error);
+  std::string s;
+  s21::serial::memory_source string_source(huge);
+  EXPECT_THROW(s21::serial::reader(string_source).read(s),
+               s21::serial::error);
+}
+
+TEST(Serialization, File) {
+  std::FILE *file = std::tmpfile();
+  ASSERT_NE(file, nullptr);
+  s21::vector<std::string> names{"ada", "grace", "barbara"};
+  s21::vector<float> values(10000, 0.25f);
+  {
+    s21::serial::file_sink sink(file);
+    s21::serial::writer out(sink);
+    out.write(names);
+    out.write(values);
+  }
+  std::rewind(file);
+  s21::serial::file_source source(file);
+  s21::serial::reader in(source);
+  EXPECT_TRUE(Same(in.get<s21::vector<std::string>>(), names));
+  EXPECT_TRUE(Same(in.get<s21::vector<float>>(), values));
+  EXPECT_THROW(in.get<int>(), s21::serial::error);
+  std::fclose(file);
+}
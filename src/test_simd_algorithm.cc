@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "simd_algorithm.h"
+
+namespace {
+
+using s21::simd::compare;
+using s21::simd::isa;
+
+// Small whole numbers, so that float sums are exact in any order
+template <class T>
+s21::vector<T> Random(std::size_t size, unsigned seed) {
+  std::mt19937 engine(seed);
+  std::uniform_int_distribution<int> value(-50, 50);
+  s21::vector<T> vec;
+  for (std::size_t i = 0; i < size; ++i)
+    vec.push_back(static_cast<T>(value(engine)));
+  return vec;
+}
+
+template <class T>
+bool Matches(T x, compare predicate, T value) {
+  switch (predicate) {
+    case compare::less:
+      return x < value;
+    case compare::less_equal:
+      return x <= value;
+    case compare::equal:
+      return x == value;
+    case compare::not_equal:
+      return x != value;
+    case compare::greater_equal:
+      return x >= value;
+    default:
+      return x > value;
+  }
+}
+
+// Every test runs once per instruction set this CPU has
+template <class T>
+class SimdAlgorithm : public testing::Test {
+ protected:
+  void TearDown() override { s21::simd::set_isa(s21::simd::detected_isa()); }
+
+  template <class Check>
+  void ForEachIsa(Check check) {
+    for (isa level : {isa::scalar, isa::sse4, isa::avx2}) {
+      if (s21::simd::set_isa(level) != level) continue;
+      SCOPED_TRACE(s21::simd::isa_name(level));
+      // Every tail length of every register width, and a long run
+      for (std::size_t size = 0; size <= 40; ++size) check(size);
+      check(1000);
+    }
+  }
+};
+
+using ElementTypes = testing::Types<std::int32_t, float, double>;
+TYPED_TEST_SUITE(SimdAlgorithm, ElementTypes);
+
+}  // namespace
+
+TYPED_TEST(SimdAlgorithm, Find) {
+  this->ForEachIsa([](std::size_t size) {
+    auto vec = Random<TypeParam>(size, 1);
+    for (int value : {-50, 0, 7, 50, 51}) {
+      auto expected = std::find(vec.begin(), vec.end(), TypeParam(value));
+      EXPECT_EQ(s21::simd::find(vec, value), expected);
+    }
+  });
+}
+
+TYPED_TEST(SimdAlgorithm, Count) {
+  this->ForEachIsa([](std::size_t size) {
+    auto vec = Random<TypeParam>(size, 2);
+    for (int value : {-50, 0, 7, 51}) {
+      auto expected = std::count(vec.begin(), vec.end(), TypeParam(value));
+      EXPECT_EQ(s21::simd::count(vec, value),
+                static_cast<std::size_t>(expected));
+    }
+  });
+}
+
+TYPED_TEST(SimdAlgorithm, MinMax) {
+  this->ForEachIsa([](std::size_t size) {
+    if (size == 0) return;
+    auto vec = Random<TypeParam>(size, 3);
+    EXPECT_EQ(s21::simd::min(vec), *std::min_element(vec.begin(), vec.end()));
+    EXPECT_EQ(s21::simd::max(vec), *std::max_element(vec.begin(), vec.end()));
+  });
+}
+
+TYPED_TEST(SimdAlgorithm, Sum) {
+  this->ForEachIsa([](std::size_t size) {
+    auto vec = Random<TypeParam>(size, 4);
+    s21::simd::sum_type<TypeParam> expected =
+        std::accumulate(vec.begin(), vec.end(),
+                        s21::simd::sum_type<TypeParam>{0});
+    EXPECT_EQ(s21::simd::sum(vec), expected);
+  });
+}
+
+TYPED_TEST(SimdAlgorithm, Filter) {
+  this->ForEachIsa([](std::size_t size) {
+    auto vec = Random<TypeParam>(size, 5);
+    for (compare predicate :
+         {compare::less, compare::less_equal, compare::equal,
+          compare::not_equal, compare::greater_equal, compare::greater}) {
+      std::vector<TypeParam> expected{TypeParam(99)};
+      std::copy_if(vec.begin(), vec.end(), std::back_inserter(expected),
+                   [&](TypeParam x) {
+                     return Matches(x, predicate, TypeParam(3));
+                   });
+      s21::vector<TypeParam> out{TypeParam(99)};
+      EXPECT_EQ(s21::simd::filter(vec, predicate, 3, out),
+                expected.size() - 1);
+      ASSERT_EQ(out.size(), expected.size());
+      EXPECT_TRUE(std::equal(out.begin(), out.end(), expected.begin()));
+    }
+  });
+}
+
+TEST(SimdAlgorithm, ExtremeValues) {
+  s21::vector<std::int32_t> vec(37, 0);
+  vec[5] = INT32_MIN;
+  vec[36] = INT32_MAX;
+  EXPECT_EQ(s21::simd::min(vec), INT32_MIN);
+  EXPECT_EQ(s21::simd::max(vec), INT32_MAX);
+  EXPECT_EQ(s21::simd::sum(vec), std::int64_t{INT32_MIN} + INT32_MAX);
+  s21::vector<std::int32_t> big(100, INT32_MAX);
+  EXPECT_EQ(s21::simd::sum(big), std::int64_t{INT32_MAX} * 100);
+}
+
+TEST(SimdAlgorithm, SetIsaClampsToCpu) {
+  isa detected = s21::simd::detected_isa();
+  EXPECT_EQ(s21::simd::set_isa(isa::scalar), isa::scalar);
+  EXPECT_EQ(s21::simd::active_isa(), isa::scalar);
+  EXPECT_EQ(s21::simd::set_isa(isa::avx2), detected);
+  EXPECT_EQ(s21::simd::active_isa(), detected);
+}
+
+TEST(VectorBulk, ResizeAndOverwrite) {
+  s21::vector<int> v{1, 2};
+  v.resize_and_overwrite(10, [](int *data, std::size_t count) {
+    EXPECT_EQ(data[1], 2);
+    for (std::size_t i = 2; i < count; ++i) data[i] = static_cast<int>(i);
+    return 5;
+  });
+  EXPECT_EQ(v.size(), 5);
+  EXPECT_GE(v.capacity(), 10);
+  EXPECT_EQ(v[4], 4);
+  v.resize_and_overwrite(1, [](int *, std::size_t) { return 1; });
+  EXPECT_EQ(v.size(), 1);
+  EXPECT_EQ(v[0], 1);
+}
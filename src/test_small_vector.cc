@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "small_vector.h"
+
+TEST(SmallVector, DefaultIsInline) {
+  s21::small_vector<int, 4> v;
+  EXPECT_EQ(v.size(), 0);
+  EXPECT_EQ(v.capacity(), 4);
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_TRUE(v.empty());
+}
+
+TEST(SmallVector, SpillsToHeap) {
+  s21::small_vector<int, 4> v;
+  for (int i = 0; i < 4; ++i) v.push_back(i);
+  EXPECT_TRUE(v.is_inline());
+  v.push_back(4);
+  EXPECT_FALSE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 8);
+  for (int i = 0; i < 5; ++i) EXPECT_EQ(v[i], i);
+}
+
+TEST(SmallVector, ShrinkToFitReturnsInline) {
+  s21::small_vector<std::string, 2> v{"a", "b", "c"};
+  EXPECT_FALSE(v.is_inline());
+  v.pop_back();
+  v.shrink_to_fit();
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 2);
+  EXPECT_EQ(v[0], "a");
+  EXPECT_EQ(v[1], "b");
+}
+
+TEST(SmallVector, InsertAndErase) {
+  s21::small_vector<std::string, 3> v;
+  std::vector<std::string> expected;
+  for (int i = 0; i < 10; ++i) {
+    v.insert(v.begin() + v.size() / 2, std::to_string(i));
+    expected.insert(expected.begin() + expected.size() / 2, std::to_string(i));
+  }
+  v.erase(v.begin() + 2);
+  expected.erase(expected.begin() + 2);
+  ASSERT_EQ(v.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i)
+    EXPECT_EQ(v[i], expected[i]);
+}
+
+TEST(SmallVector, AccessOutOfRange) {
+  s21::small_vector<int, 2> v{1, 2};
+  EXPECT_THROW(v.at(2), std::out_of_range);
+  EXPECT_EQ(v.front(), 1);
+  EXPECT_EQ(v.back(), 2);
+  v.clear();
+  EXPECT_THROW(v.pop_back(), std::length_error);
+#if S21_VECTOR_HARDENED
+  EXPECT_DEATH(v.front(), "empty container");
+  EXPECT_DEATH(v[0], "out of range");
+#endif
+}
+
+TEST(SmallVector, MoveInlineAndHeap) {
+  s21::small_vector<std::string, 2> small{"x"};
+  s21::small_vector<std::string, 2> moved(std::move(small));
+  EXPECT_TRUE(moved.is_inline());
+  EXPECT_EQ(moved[0], "x");
+  EXPECT_TRUE(small.empty());
+
+  s21::small_vector<std::string, 2> big{"a", "b", "c"};
+  const std::string *block = big.data();
+  s21::small_vector<std::string, 2> stolen(std::move(big));
+  EXPECT_EQ(stolen.data(), block);
+  EXPECT_TRUE(big.is_inline());
+  EXPECT_TRUE(big.empty());
+
+  moved = std::move(stolen);
+  EXPECT_EQ(moved.data(), block);
+  EXPECT_EQ(moved.size(), 3);
+  // Inline elements move into the heap block that is already owned
+  moved = s21::small_vector<std::string, 2>{"y"};
+  EXPECT_EQ(moved.data(), block);
+  EXPECT_EQ(moved.size(), 1);
+  EXPECT_EQ(moved[0], "y");
+}
+
+TEST(SmallVector, CopyAssignment) {
+  s21::small_vector<std::string, 2> a{"a", "b", "c"};
+  s21::small_vector<std::string, 2> b{"z"};
+  b = a;
+  EXPECT_EQ(b.size(), 3);
+  EXPECT_EQ(b[2], "c");
+  EXPECT_EQ(a[2], "c");
+}
+
+TEST(SmallVector, SwapAllStates) {
+  using sv = s21::small_vector<std::string, 3>;
+  sv inline_a{"a1", "a2"};
+  sv inline_b{"b1", "b2", "b3"};
+  inline_a.swap(inline_b);
+  EXPECT_EQ(inline_a.size(), 3);
+  EXPECT_EQ(inline_a[2], "b3");
+  EXPECT_EQ(inline_b.size(), 2);
+  EXPECT_EQ(inline_b[1], "a2");
+
+  sv heap{"h1", "h2", "h3", "h4"};
+  const std::string *block = heap.data();
+  heap.swap(inline_b);
+  EXPECT_TRUE(heap.is_inline());
+  EXPECT_EQ(heap[0], "a1");
+  EXPECT_EQ(inline_b.data(), block);
+  EXPECT_EQ(inline_b[3], "h4");
+
+  sv other_heap{"o1", "o2", "o3", "o4", "o5"};
+  other_heap.swap(inline_b);
+  EXPECT_EQ(other_heap.data(), block);
+  EXPECT_EQ(inline_b.size(), 5);
+  EXPECT_EQ(inline_b[4], "o5");
+}
+
+TEST(SmallVector, SelfReferencingPushBack) {
+  s21::small_vector<std::string, 2> v{"first", "second"};
+  v.push_back(v[0]);
+  EXPECT_EQ(v[2], "first");
+}
+
+TEST(SmallVector, Emplace) {
+  s21::small_vector<std::string, 2> v;
+  v.emplace_back(3, 'a');
+  std::string &ref = v.emplace_back("b");
+  EXPECT_EQ(ref, "b");
+  v.emplace(v.begin() + 1, v[0]);
+  ASSERT_EQ(v.size(), 3);
+  EXPECT_EQ(v[0], "aaa");
+  EXPECT_EQ(v[1], "aaa");
+  EXPECT_EQ(v[2], "b");
+}
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <string>
+
+#include "soa_vector.h"
+
+namespace {
+
+using Particles = s21::soa_vector<float, double, std::uint8_t>;
+
+// Throws on the copy after the countdown runs out
+struct Fragile {
+  static inline int countdown = -1;
+  int value = 0;
+
+  Fragile() = default;
+  explicit Fragile(int v) : value(v) {}
+  Fragile(const Fragile &other) : value(other.value) {
+    if (countdown >= 0 && countdown-- == 0) throw std::runtime_error("copy");
+  }
+  Fragile &operator=(const Fragile &) = default;
+};
+
+template <class T>
+bool Aligned(const T *ptr) {
+  return reinterpret_cast<std::uintptr_t>(ptr) % 64 == 0;
+}
+
+}  // namespace
+
+TEST(SoaVector, PushAndAccess) {
+  Particles p;
+  EXPECT_TRUE(p.empty());
+  EXPECT_EQ(p.data<0>().data(), nullptr);
+  for (int i = 0; i < 100; ++i)
+    p.push_back({i * 1.0f, i * 2.0, static_cast<std::uint8_t>(i)});
+  ASSERT_EQ(p.size(), 100);
+  EXPECT_GE(p.capacity(), 100);
+  EXPECT_EQ(std::get<0>(p[10]), 10.0f);
+  EXPECT_EQ(std::get<1>(p[10]), 20.0);
+  EXPECT_EQ(std::get<2>(p.back()), 99);
+  EXPECT_EQ(std::get<1>(p.front()), 0.0);
+  EXPECT_THROW(p.at(100), std::out_of_range);
+
+  auto [x, y, tag] = p[5];
+  x = -1.0f;
+  tag = 200;
+  EXPECT_EQ(std::get<0>(p[5]), -1.0f);
+  EXPECT_EQ(p.data<2>()[5], 200);
+  EXPECT_EQ(y, 10.0);
+  p[6] = Particles::value_type{7.0f, 8.0, 9};
+  EXPECT_EQ(std::get<1>(p.at(6)), 8.0);
+}
+
+TEST(SoaVector, ColumnsAreAlignedAndContiguous) {
+  Particles p(1000);
+  EXPECT_TRUE(Aligned(p.data<0>().data()));
+  EXPECT_TRUE(Aligned(p.data<1>().data()));
+  EXPECT_TRUE(Aligned(p.data<2>().data()));
+  EXPECT_EQ(p.data<1>().size(), 1000);
+  std::iota(p.data<1>().begin(), p.data<1>().end(), 0.0);
+  EXPECT_EQ(std::accumulate(p.data<1>().begin(), p.data<1>().end(), 0.0),
+            999.0 * 1000 / 2);
+  for (float x : p.data<0>()) EXPECT_EQ(x, 0.0f);
+}
+
+TEST(SoaVector, EmplaceBackReturnsRow) {
+  s21::soa_vector<std::string, int> v;
+  auto row = v.emplace_back("abc", 1);
+  std::get<1>(row) = 5;
+  EXPECT_EQ(std::get<1>(v[0]), 5);
+  // An argument referring into the vector survives the growth
+  for (int i = 0; i < 20; ++i) v.emplace_back(std::get<0>(v[0]), i);
+  EXPECT_EQ(std::get<0>(v.back()), "abc");
+  v.pop_back();
+  EXPECT_EQ(v.size(), 20);
+  v.clear();
+  EXPECT_THROW(v.pop_back(), std::length_error);
+}
+
+TEST(SoaVector, NonTrivialColumns) {
+  s21::soa_vector<std::unique_ptr<int>, std::string> v;
+  for (int i = 0; i < 50; ++i)
+    v.emplace_back(std::make_unique<int>(i), std::to_string(i));
+  EXPECT_EQ(*std::get<0>(v[49]), 49);
+  EXPECT_EQ(std::get<1>(v[49]), "49");
+  v.resize(10);
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 10);
+  EXPECT_EQ(*std::get<0>(v.back()), 9);
+  s21::soa_vector<std::unique_ptr<int>, std::string> moved(std::move(v));
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(moved.size(), 10);
+}
+
+TEST(SoaVector, CopyAndAssign) {
+  s21::soa_vector<std::string, int> a{{"x", 1}, {"y", 2}};
+  s21::soa_vector<std::string, int> b(a);
+  EXPECT_EQ(std::get<0>(b[1]), "y");
+  a.push_back({"z", 3});
+  b = a;
+  EXPECT_EQ(b.size(), 3);
+  s21::soa_vector<std::string, int> c;
+  c = std::move(b);
+  EXPECT_EQ(std::get<1>(c.back()), 3);
+  c.swap(b);
+  EXPECT_EQ(b.size(), 3);
+  EXPECT_TRUE(c.empty());
+}
+
+TEST(SoaVector, Iterators) {
+  s21::soa_vector<int, char> v;
+  for (int i = 0; i < 10; ++i) v.emplace_back(i, static_cast<char>('a' + i));
+  EXPECT_EQ(v.end() - v.begin(), 10);
+  int sum = 0;
+  for (auto [n, c] : v) {
+    sum += n;
+    c = 'z';
+  }
+  EXPECT_EQ(sum, 45);
+  EXPECT_EQ(v.data<1>()[3], 'z');
+  const auto &cv = v;
+  s21::soa_vector<int, char>::const_iterator it = v.begin();
+  EXPECT_EQ(it, cv.begin());
+  it += 4;
+  EXPECT_EQ(std::get<0>(*it), 4);
+  EXPECT_EQ(std::get<0>(it[-1]), 3);
+  auto found = std::find_if(cv.begin(), cv.end(), [](const auto &row) {
+    return std::get<0>(row) == 7;
+  });
+  EXPECT_EQ(found - cv.begin(), 7);
+}
+
+TEST(SoaVector, GrowthKeepsRowsOnThrowingCopy) {
+  s21::soa_vector<int, Fragile> v;
+  v.reserve(4);
+  for (int i = 0; i < 4; ++i) v.emplace_back(i, Fragile(i));
+  Fragile::countdown = 2;
+  EXPECT_THROW(v.emplace_back(4, Fragile(4)), std::runtime_error);
+  Fragile::countdown = -1;
+  EXPECT_EQ(v.size(), 4);
+  EXPECT_EQ(v.capacity(), 4);
+  for (int i = 0; i < 4; ++i) EXPECT_EQ(v.data<1>()[i].value, i);
+}
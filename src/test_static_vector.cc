@@ -0,0 +1,232 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "static_vector.h"
+
+namespace {
+
+// Constant evaluation needs C++20, which allows the uninitialized slots
+constexpr s21::static_vector<int, 8> Squares(int count) {
+  s21::static_vector<int, 8> v;
+  for (int i = 0; i < count; ++i) v.push_back(i * i);
+  v.insert(v.begin(), -1);
+  v.erase(v.begin() + 1);
+  return v;
+}
+
+constexpr int Sum(const s21::static_vector<int, 8> &v) {
+  int sum = 0;
+  for (int x : v) sum += x;
+  return sum;
+}
+
+#if __cplusplus >= 202002L
+static_assert(Sum(Squares(4)) == -1 + 1 + 4 + 9);
+static_assert(Squares(7).size() == 7);
+#endif
+static_assert(s21::static_vector<int, 8>::capacity() == 8);
+
+// Trivially copyable, but not trivial
+struct Quote {
+  int id = 0;
+  double price = 0;
+};
+
+static_assert(std::is_trivially_copyable_v<s21::static_vector<int, 4>>);
+static_assert(std::is_trivially_copyable_v<s21::static_vector<Quote, 4>>);
+static_assert(
+    !std::is_trivially_copyable_v<s21::static_vector<std::string, 4>>);
+
+// Counts live objects to catch leaks and double destruction
+struct Tracked {
+  static inline int alive = 0;
+  int value;
+
+  Tracked(int v = 0) : value(v) { ++alive; }
+  Tracked(const Tracked &other) : value(other.value) { ++alive; }
+  Tracked(Tracked &&other) noexcept : value(other.value) { ++alive; }
+  Tracked &operator=(const Tracked &) = default;
+  Tracked &operator=(Tracked &&) = default;
+  ~Tracked() { --alive; }
+};
+
+}  // namespace
+
+TEST(StaticVector, LivesInline) {
+  s21::static_vector<int, 4> v{1, 2, 3};
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(v.capacity(), 4);
+  auto *object = reinterpret_cast<const char *>(&v);
+  auto *elements = reinterpret_cast<const char *>(v.data());
+  EXPECT_GE(elements, object);
+  EXPECT_LT(elements, object + sizeof(v));
+}
+
+TEST(StaticVector, OverflowThrows) {
+  s21::static_vector<std::string, 2> v{"a", "b"};
+  EXPECT_THROW(v.push_back("c"), std::length_error);
+  EXPECT_THROW(v.insert(v.begin(), "c"), std::length_error);
+  EXPECT_THROW(v.reserve(3), std::length_error);
+  EXPECT_THROW((s21::static_vector<int, 2>(3)), std::length_error);
+  ASSERT_EQ(v.size(), 2);
+  EXPECT_EQ(v[0], "a");
+  EXPECT_EQ(v[1], "b");
+}
+
+TEST(StaticVector, TryPushBack) {
+  s21::static_vector<std::string, 2> v;
+  std::string value = "a";
+  EXPECT_TRUE(v.try_push_back(value));
+  EXPECT_NE(v.try_emplace_back(3, 'b'), nullptr);
+  std::string last = "c";
+  EXPECT_FALSE(v.try_push_back(std::move(last)));
+  EXPECT_EQ(last, "c");
+  EXPECT_EQ(v.try_emplace_back("d"), nullptr);
+  ASSERT_EQ(v.size(), 2);
+  EXPECT_EQ(v[1], "bbb");
+}
+
+TEST(StaticVector, OverflowAborts) {
+  s21::static_vector<int, 1, s21::overflow::abort> v{1};
+  EXPECT_DEATH(v.push_back(2), "emplace_back The container is full");
+}
+
+TEST(StaticVector, AccessOutOfRange) {
+  s21::static_vector<int, 2> v{1, 2};
+  EXPECT_THROW(v.at(2), std::out_of_range);
+  EXPECT_EQ(v.front(), 1);
+  EXPECT_EQ(v.back(), 2);
+  v.clear();
+  EXPECT_THROW(v.pop_back(), std::length_error);
+#if S21_VECTOR_HARDENED
+  EXPECT_DEATH(v.front(), "empty container");
+  EXPECT_DEATH(v[0], "out of range");
+#endif
+}
+
+TEST(StaticVector, InsertAndErase) {
+  s21::static_vector<std::string, 16> v;
+  std::vector<std::string> expected;
+  for (int i = 0; i < 10; ++i) {
+    v.insert(v.begin() + v.size() / 2, std::to_string(i));
+    expected.insert(expected.begin() + expected.size() / 2, std::to_string(i));
+  }
+  v.insert(v.begin() + 1, 2, "x");
+  expected.insert(expected.begin() + 1, 2, "x");
+  v.insert(v.end() - 1, {"y", "z"});
+  expected.insert(expected.end() - 1, {"y", "z"});
+  v.erase(v.begin() + 2);
+  expected.erase(expected.begin() + 2);
+  v.erase(v.begin() + 3, v.begin() + 6);
+  expected.erase(expected.begin() + 3, expected.begin() + 6);
+  ASSERT_EQ(v.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i)
+    EXPECT_EQ(v[i], expected[i]);
+  EXPECT_THROW(v.erase(v.end()), std::out_of_range);
+}
+
+TEST(StaticVector, UnorderedEraseAndEraseIf) {
+  s21::static_vector<int, 8> v{0, 1, 2, 3, 4, 5};
+  v.unordered_erase(v.begin() + 1);
+  ASSERT_EQ(v.size(), 5);
+  EXPECT_EQ(v[1], 5);
+  EXPECT_EQ(s21::erase_if(v, [](int x) { return x % 2 == 0; }), 3);
+  ASSERT_EQ(v.size(), 2);
+  EXPECT_EQ(v[0], 5);
+  EXPECT_EQ(v[1], 3);
+  EXPECT_EQ(s21::erase(v, 3), 1);
+  EXPECT_EQ(v.size(), 1);
+}
+
+TEST(StaticVector, Resize) {
+  s21::static_vector<std::string, 4> v{"a"};
+  v.resize(3, "b");
+  ASSERT_EQ(v.size(), 3);
+  EXPECT_EQ(v[2], "b");
+  v.resize(1);
+  EXPECT_EQ(v.size(), 1);
+  v.resize(2);
+  EXPECT_EQ(v[1], "");
+  EXPECT_THROW(v.resize(5), std::length_error);
+}
+
+TEST(StaticVector, CopyAndMove) {
+  s21::static_vector<std::string, 4> a{"a", "b", "c"};
+  s21::static_vector<std::string, 4> b(a);
+  ASSERT_EQ(b.size(), 3);
+  EXPECT_EQ(b[2], "c");
+  s21::static_vector<std::string, 4> c{"x"};
+  c = a;
+  ASSERT_EQ(c.size(), 3);
+  EXPECT_EQ(c[0], "a");
+  c = s21::static_vector<std::string, 4>{"y"};
+  ASSERT_EQ(c.size(), 1);
+  EXPECT_EQ(c[0], "y");
+  s21::static_vector<std::string, 4> d(std::move(a));
+  ASSERT_EQ(d.size(), 3);
+  EXPECT_EQ(d[1], "b");
+}
+
+TEST(StaticVector, TrivialCopyIsBytewise) {
+  s21::static_vector<int, 4> a{1, 2};
+  s21::static_vector<int, 4> b;
+  std::memcpy(static_cast<void *>(&b), &a, sizeof(a));
+  ASSERT_EQ(b.size(), 2);
+  EXPECT_EQ(b[1], 2);
+  s21::static_vector<Quote, 4> quotes;
+  quotes.push_back({7, 1.5});
+  quotes.emplace_back();
+  auto copy = quotes;
+  ASSERT_EQ(copy.size(), 2);
+  EXPECT_EQ(copy[0].id, 7);
+  EXPECT_EQ(copy[1].price, 0);
+}
+
+TEST(StaticVector, ConstexprFunctionsAtRunTime) {
+  EXPECT_EQ(Sum(Squares(4)), -1 + 1 + 4 + 9);
+  EXPECT_EQ(Squares(7).size(), 7);
+}
+
+TEST(StaticVector, Swap) {
+  s21::static_vector<std::string, 4> a{"a", "b", "c"};
+  s21::static_vector<std::string, 4> b{"x"};
+  a.swap(b);
+  ASSERT_EQ(a.size(), 1);
+  ASSERT_EQ(b.size(), 3);
+  EXPECT_EQ(a[0], "x");
+  EXPECT_EQ(b[0], "a");
+  EXPECT_EQ(b[2], "c");
+  b.swap(a);
+  ASSERT_EQ(a.size(), 3);
+  EXPECT_EQ(b[0], "x");
+}
+
+TEST(StaticVector, Lifetimes) {
+  {
+    s21::static_vector<Tracked, 8> v;
+    for (int i = 0; i < 6; ++i) v.emplace_back(i);
+    v.insert(v.begin() + 2, Tracked(10));
+    v.erase(v.begin(), v.begin() + 2);
+    v.unordered_erase(v.begin());
+    s21::static_vector<Tracked, 8> copy(v);
+    s21::static_vector<Tracked, 8> other{1, 2};
+    other.swap(copy);
+    copy = other;
+    v.pop_back();
+    EXPECT_EQ(Tracked::alive, static_cast<int>(v.size() + copy.size() +
+                                               other.size()));
+  }
+  EXPECT_EQ(Tracked::alive, 0);
+}
+
+TEST(StaticVector, SelfReferencingPushBack) {
+  s21::static_vector<std::string, 4> v{"abc"};
+  v.push_back(v[0]);
+  v.insert(v.begin(), v[1]);
+  ASSERT_EQ(v.size(), 3);
+  for (const auto &s : v) EXPECT_EQ(s, "abc");
+}
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+
+#include "thread_pool.h"
+
+TEST(ThreadPool, RunsAllTasks) {
+  s21::thread_pool pool(3);
+  EXPECT_EQ(pool.size(), 3);
+  EXPECT_EQ(pool.concurrency(), 4);
+  std::atomic<int> done{0};
+  s21::task_group group(pool);
+  for (int i = 0; i < 1000; ++i) group.run([&done] { ++done; });
+  group.wait();
+  EXPECT_EQ(done, 1000);
+}
+
+TEST(ThreadPool, WithoutWorkersTheWaiterRuns) {
+  s21::thread_pool pool(0);
+  int done = 0;
+  s21::task_group group(pool);
+  for (int i = 0; i < 10; ++i) group.run([&done] { ++done; });
+  group.wait();
+  EXPECT_EQ(done, 10);
+}
+
+TEST(ThreadPool, NestedGroupsDontDeadlock) {
+  s21::thread_pool pool(2);
+  std::atomic<int> done{0};
+  s21::task_group outer(pool);
+  for (int i = 0; i < 8; ++i) {
+    outer.run([&pool, &done] {
+      s21::task_group inner(pool);
+      for (int j = 0; j < 8; ++j) inner.run([&done] { ++done; });
+      inner.wait();
+    });
+  }
+  outer.wait();
+  EXPECT_EQ(done, 64);
+}
+
+TEST(ThreadPool, WaitRethrows) {
+  s21::thread_pool pool(2);
+  std::atomic<int> done{0};
+  s21::task_group group(pool);
+  group.run([] { throw std::runtime_error("task"); });
+  for (int i = 0; i < 10; ++i) group.run([&done] { ++done; });
+  EXPECT_THROW(group.wait(), std::runtime_error);
+  EXPECT_EQ(done, 10);
+  EXPECT_NO_THROW(group.wait());
+}
+
+TEST(ThreadPool, CurrentIndex) {
+  s21::thread_pool pool(2);
+  EXPECT_EQ(pool.current_index(), pool.size());
+  std::atomic<bool> in_range{true};
+  s21::task_group group(pool);
+  for (int i = 0; i < 100; ++i)
+    group.run([&] {
+      if (pool.current_index() > pool.size()) in_range = false;
+    });
+  group.wait();
+  EXPECT_TRUE(in_range);
+}
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <list>
+#include <sstream>
+#include <string>
 #include <vector>
 
 #include "vector.h"
@@ -117,6 +120,29 @@ TEST(VectorTest, AccessElementsOutOfRange) {
   EXPECT_THROW(vec.at(5), std::out_of_range);
 }
 
+TEST(VectorTest, NoOverheadWithoutStats) {
+  EXPECT_EQ(sizeof(s21::vector<int>), 3 * sizeof(void *));
+}
+
+TEST(VectorTest, UncheckedAccess) {
+  s21::vector<int> vec{5, 8, 10};
+  EXPECT_EQ(vec[2], 10);
+  EXPECT_EQ(vec.front(), 5);
+  EXPECT_EQ(vec.back(), 10);
+  EXPECT_EQ(&vec[1], vec.data() + 1);
+  static_assert(noexcept(vec[0]));
+}
+
+#if S21_VECTOR_HARDENED
+TEST(VectorDeathTest, HardenedAccessAborts) {
+  s21::vector<int> vec{5, 8, 10};
+  EXPECT_DEATH(vec[3], "operator\\[\\] The index is out of range");
+  s21::vector<int> empty;
+  EXPECT_DEATH(empty.front(), "front Called on an empty container");
+  EXPECT_DEATH(empty.back(), "back Called on an empty container");
+}
+#endif
+
 TEST(VectorTests, ConstructorTests) {
   s21::vector<int> s21v1;
   std::vector<int> stdv1;
@@ -242,25 +268,25 @@ TEST(VectorTests, ClearTests) {
   EXPECT_EQ(s21v.empty(), stdv.empty());
 }
 
-// TEST(VectorTest, EmplaceBack) {
-//// Test emplace_back() with string values
-// s21::vector<std::string> s_vec;
-// std::vector<std::string> std_vec;
-// s_vec.emplace_back("one");
-// std_vec.emplace_back("one");
-// s_vec.emplace_back("two");
-// std_vec.emplace_back("two");
-// s_vec.emplace_back("three");
-// std_vec.emplace_back("three");
-//
-//// Check if both vectors have the same size
-// EXPECT_EQ(s_vec.size(), std_vec.size());
-//
-//// Check if both vectors have the same values
-// for (int i = 0; i < 3; i++) {
-// EXPECT_EQ(s_vec[i], std_vec[i]);
-// }
-// }
+TEST(VectorTest, EmplaceBack) {
+  // Test emplace_back() with string values
+  s21::vector<std::string> s_vec;
+  std::vector<std::string> std_vec;
+  s_vec.emplace_back("one");
+  std_vec.emplace_back("one");
+  s_vec.emplace_back("two");
+  std_vec.emplace_back("two");
+  s_vec.emplace_back("three");
+  std_vec.emplace_back("three");
+
+  // Check if both vectors have the same size
+  EXPECT_EQ(s_vec.size(), std_vec.size());
+
+  // Check if both vectors have the same values
+  for (int i = 0; i < 3; i++) {
+    EXPECT_EQ(s_vec[i], std_vec[i]);
+  }
+}
 
 // Test if s21::vector behaves like std::vector when it comes to size and
 // capacity
@@ -497,4 +523,540 @@ TEST(S21VectorString, Capacity) {
   s21_vec.shrink_to_fit();
   std_vec.shrink_to_fit();
   EXPECT_EQ(s21_vec.capacity(), std_vec.capacity());
-}
\ No newline at end of file
+}
+namespace {
+// Counts live objects to check that the vector constructs and destroys
+// exactly the elements in [0, size())
+struct Tracked {
+  static int alive;
+  static int default_constructed;
+  int value = 0;
+  Tracked() {
+    ++alive;
+    ++default_constructed;
+  }
+  Tracked(int v) : value(v) { ++alive; }
+  Tracked(const Tracked &other) : value(other.value) { ++alive; }
+  Tracked(Tracked &&other) noexcept : value(other.value) { ++alive; }
+  Tracked &operator=(const Tracked &) = default;
+  Tracked &operator=(Tracked &&) noexcept = default;
+  ~Tracked() { --alive; }
+};
+int Tracked::alive = 0;
+int Tracked::default_constructed = 0;
+}  // namespace
+
+TEST(VectorLifetime, ReserveDoesNotConstruct) {
+  Tracked::alive = 0;
+  Tracked::default_constructed = 0;
+  {
+    s21::vector<Tracked> v;
+    v.reserve(100);
+    EXPECT_EQ(Tracked::alive, 0);
+    for (int i = 0; i < 10; ++i) v.push_back(Tracked(i));
+    EXPECT_EQ(Tracked::alive, 10);
+    EXPECT_EQ(Tracked::default_constructed, 0);
+  }
+  EXPECT_EQ(Tracked::alive, 0);
+}
+
+TEST(VectorLifetime, GrowthKeepsOnlyLiveElements) {
+  Tracked::alive = 0;
+  Tracked::default_constructed = 0;
+  {
+    s21::vector<Tracked> v;
+    for (int i = 0; i < 100; ++i) v.push_back(Tracked(i));
+    EXPECT_EQ(Tracked::alive, 100);
+    EXPECT_EQ(Tracked::default_constructed, 0);
+    for (int i = 0; i < 100; ++i) EXPECT_EQ(v[i].value, i);
+  }
+  EXPECT_EQ(Tracked::alive, 0);
+}
+
+TEST(VectorLifetime, RemovalDestroysElements) {
+  Tracked::alive = 0;
+  {
+    s21::vector<Tracked> v{1, 2, 3, 4, 5};
+    EXPECT_EQ(Tracked::alive, 5);
+    v.pop_back();
+    EXPECT_EQ(Tracked::alive, 4);
+    v.erase(v.begin());
+    EXPECT_EQ(Tracked::alive, 3);
+    EXPECT_EQ(v[0].value, 2);
+    v.insert(v.begin() + 1, Tracked(7));
+    EXPECT_EQ(Tracked::alive, 4);
+    EXPECT_EQ(v[1].value, 7);
+    EXPECT_EQ(v[2].value, 3);
+    v.clear();
+    EXPECT_EQ(Tracked::alive, 0);
+    EXPECT_EQ(v.capacity(), 5);
+  }
+  EXPECT_EQ(Tracked::alive, 0);
+}
+
+TEST(VectorLifetime, SizeConstructorValueInitializes) {
+  Tracked::alive = 0;
+  Tracked::default_constructed = 0;
+  {
+    s21::vector<Tracked> v(4);
+    EXPECT_EQ(Tracked::default_constructed, 4);
+    s21::vector<int> ints(16);
+    for (int x : ints) EXPECT_EQ(x, 0);
+  }
+  EXPECT_EQ(Tracked::alive, 0);
+}
+
+TEST(VectorLifetime, SelfReferencingInsert) {
+  s21::vector<std::string> v{"first", "second"};
+  v.shrink_to_fit();
+  v.push_back(v[0]);
+  v.insert(v.begin(), v[2]);
+  EXPECT_EQ(v.size(), 4);
+  EXPECT_EQ(v[0], "first");
+  EXPECT_EQ(v[1], "first");
+  EXPECT_EQ(v[3], "first");
+}
+
+TEST(VectorLifetime, AssignmentReleasesOldElements) {
+  Tracked::alive = 0;
+  {
+    s21::vector<Tracked> a{1, 2, 3};
+    s21::vector<Tracked> b{4, 5};
+    a = b;
+    EXPECT_EQ(Tracked::alive, 4);
+    a = std::move(b);
+    EXPECT_EQ(Tracked::alive, 2);
+  }
+  EXPECT_EQ(Tracked::alive, 0);
+}
+
+namespace {
+// Stateful allocator that counts the live allocations of its pool id
+template <class T>
+struct CountingAllocator {
+  using value_type = T;
+  using propagate_on_container_move_assignment = std::false_type;
+
+  int id = 0;
+  int *live = nullptr;
+
+  CountingAllocator(int pool, int *counter) : id{pool}, live{counter} {}
+  template <class U>
+  CountingAllocator(const CountingAllocator<U> &other)
+      : id{other.id}, live{other.live} {}
+
+  T *allocate(std::size_t count) {
+    ++*live;
+    return std::allocator<T>().allocate(count);
+  }
+  void deallocate(T *ptr, std::size_t count) {
+    --*live;
+    std::allocator<T>().deallocate(ptr, count);
+  }
+  bool operator==(const CountingAllocator &other) const {
+    return id == other.id;
+  }
+  bool operator!=(const CountingAllocator &other) const {
+    return id != other.id;
+  }
+};
+}  // namespace
+
+TEST(VectorAllocator, AllocationsGoThroughAllocator) {
+  int live = 0;
+  {
+    CountingAllocator<int> alloc(1, &live);
+    s21::vector<int, CountingAllocator<int>> v(alloc);
+    for (int i = 0; i < 100; ++i) v.push_back(i);
+    EXPECT_EQ(live, 1);
+    EXPECT_EQ(v.get_allocator().id, 1);
+  }
+  EXPECT_EQ(live, 0);
+}
+
+TEST(VectorAllocator, MoveAssignmentBetweenUnequalAllocators) {
+  int live = 0;
+  {
+    using counting_vector = s21::vector<int, CountingAllocator<int>>;
+    counting_vector a({1, 2, 3}, CountingAllocator<int>(1, &live));
+    counting_vector b(CountingAllocator<int>(2, &live));
+    b = std::move(a);
+    EXPECT_EQ(b.get_allocator().id, 2);
+    EXPECT_EQ(b.size(), 3);
+    EXPECT_EQ(b[1], 2);
+  }
+  EXPECT_EQ(live, 0);
+}
+
+namespace {
+// Owns a heap int, so it is not trivially copyable, but its bytes can be
+// moved around freely; it opts into the relocation fast path
+struct Handle {
+  static int moves;
+  int *value;
+  explicit Handle(int v) : value{new int(v)} {}
+  Handle(const Handle &other) : value{new int(*other.value)} {}
+  Handle(Handle &&other) noexcept
+      : value{std::exchange(other.value, nullptr)} {
+    ++moves;
+  }
+  Handle &operator=(Handle other) noexcept {
+    std::swap(value, other.value);
+    return *this;
+  }
+  ~Handle() { delete value; }
+};
+int Handle::moves = 0;
+}  // namespace
+
+template <>
+struct s21::is_trivially_relocatable<Handle> : std::true_type {};
+
+TEST(VectorRelocation, TraitDefaults) {
+  EXPECT_TRUE(s21::is_trivially_relocatable_v<int>);
+  EXPECT_TRUE(s21::is_trivially_relocatable_v<Handle>);
+  EXPECT_FALSE(s21::is_trivially_relocatable_v<std::string>);
+}
+
+TEST(VectorRelocation, GrowthDoesNotMoveConstruct) {
+  Handle::moves = 0;
+  s21::vector<Handle> v;
+  for (int i = 0; i < 100; ++i) v.push_back(Handle(i));
+  EXPECT_EQ(Handle::moves, 100);
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(*v[i].value, i);
+}
+
+TEST(VectorRelocation, InsertAndEraseShiftBytes) {
+  s21::vector<Handle> v;
+  for (int i = 0; i < 10; ++i) v.push_back(Handle(i));
+  Handle::moves = 0;
+  v.insert(v.begin() + 5, Handle(100));
+  v.insert(v.begin(), Handle(200));
+  EXPECT_EQ(Handle::moves, 2);
+  v.erase(v.begin() + 3);
+  v.erase(v.end() - 1);
+  int expected[] = {200, 0, 1, 3, 4, 100, 5, 6, 7, 8};
+  ASSERT_EQ(v.size(), 10);
+  for (int i = 0; i < 10; ++i) EXPECT_EQ(*v[i].value, expected[i]);
+}
+
+TEST(VectorRelocation, IntInsertAndErase) {
+  s21::vector<int> v;
+  std::vector<int> expected;
+  for (int i = 0; i < 50; ++i) {
+    v.insert(v.begin() + v.size() / 2, i);
+    expected.insert(expected.begin() + expected.size() / 2, i);
+  }
+  for (int i = 0; i < 20; ++i) {
+    v.erase(v.begin() + i);
+    expected.erase(expected.begin() + i);
+  }
+  ASSERT_EQ(v.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i)
+    EXPECT_EQ(v[i], expected[i]);
+}
+
+namespace {
+// Counts how often objects are built, copied and moved
+struct Heavy {
+  static int constructed;
+  static int copies;
+  static int moves;
+  std::string name;
+  int weight;
+  Heavy(std::string n, int w) : name(std::move(n)), weight(w) {
+    ++constructed;
+  }
+  Heavy(const Heavy &other) : name(other.name), weight(other.weight) {
+    ++copies;
+  }
+  Heavy(Heavy &&other) noexcept
+      : name(std::move(other.name)), weight(other.weight) {
+    ++moves;
+  }
+  Heavy &operator=(const Heavy &) = default;
+  Heavy &operator=(Heavy &&) noexcept = default;
+  static void Reset() { constructed = copies = moves = 0; }
+};
+int Heavy::constructed = 0;
+int Heavy::copies = 0;
+int Heavy::moves = 0;
+}  // namespace
+
+TEST(VectorEmplace, EmplaceBackConstructsInPlace) {
+  s21::vector<Heavy> v;
+  v.reserve(4);
+  Heavy::Reset();
+  Heavy &ref = v.emplace_back("anvil", 50);
+  v.emplace_back("feather", 1);
+  EXPECT_EQ(&ref, &v[0]);
+  EXPECT_EQ(Heavy::constructed, 2);
+  EXPECT_EQ(Heavy::copies, 0);
+  EXPECT_EQ(Heavy::moves, 0);
+  EXPECT_EQ(v[1].name, "feather");
+}
+
+TEST(VectorEmplace, GrowthMovesOnlyOldElements) {
+  s21::vector<Heavy> v;
+  v.emplace_back("a", 1);
+  v.emplace_back("b", 2);
+  Heavy::Reset();
+  v.emplace_back("c", 3);
+  EXPECT_EQ(Heavy::constructed, 1);
+  EXPECT_EQ(Heavy::copies, 0);
+  EXPECT_EQ(Heavy::moves, 2);
+}
+
+TEST(VectorEmplace, SelfReferenceDuringReallocation) {
+  s21::vector<Heavy> v;
+  v.emplace_back("self", 7);
+  v.emplace_back("other", 8);
+  ASSERT_EQ(v.size(), v.capacity());
+  Heavy::Reset();
+  v.emplace_back(v[0]);
+  EXPECT_EQ(Heavy::copies, 1);
+  EXPECT_EQ(Heavy::moves, 2);
+  EXPECT_EQ(v[2].name, "self");
+  EXPECT_EQ(v[0].name, "self");
+
+  s21::vector<std::string> strings{"long enough to live on the heap", "x"};
+  strings.emplace(strings.begin() + 1, strings[0]);
+  EXPECT_EQ(strings[1], strings[0]);
+  strings.emplace(strings.begin(), strings[2]);
+  EXPECT_EQ(strings[0], "x");
+}
+
+TEST(VectorEmplace, EmplaceMiddle) {
+  s21::vector<Heavy> v;
+  v.reserve(8);
+  v.emplace_back("a", 1);
+  v.emplace_back("c", 3);
+  auto it = v.emplace(v.begin() + 1, "b", 2);
+  EXPECT_EQ(it, v.begin() + 1);
+  EXPECT_EQ(v[0].name, "a");
+  EXPECT_EQ(v[1].name, "b");
+  EXPECT_EQ(v[2].name, "c");
+  EXPECT_THROW(v.emplace(v.end() + 1, "d", 4), std::out_of_range);
+
+  s21::vector<int> ints{1, 2, 3};
+  ints.emplace(ints.begin() + 1, 9);
+  ints.emplace(ints.begin() + 1, ints[3]);
+  EXPECT_EQ(ints.size(), 5);
+  EXPECT_EQ(ints[0], 1);
+  EXPECT_EQ(ints[1], 3);
+  EXPECT_EQ(ints[2], 9);
+  EXPECT_EQ(ints[4], 3);
+}
+
+TEST(VectorBulk, CountValueConstructorAndInsert) {
+  s21::vector<std::string> v(3, "ab");
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(v.capacity(), 3);
+  EXPECT_EQ(v[2], "ab");
+  auto it = v.insert(v.begin() + 1, 2, "x");
+  EXPECT_EQ(it, v.begin() + 1);
+  std::vector<std::string> expected{"ab", "x", "x", "ab", "ab"};
+  ASSERT_EQ(v.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i)
+    EXPECT_EQ(v[i], expected[i]);
+  v.insert(v.begin(), 3, v[1]);
+  EXPECT_EQ(v[0], "x");
+  EXPECT_EQ(v[3], "ab");
+
+  s21::vector<int> ints(4, 7);
+  ints.insert(ints.end(), 2, 1);
+  EXPECT_EQ(ints.size(), 6);
+  EXPECT_EQ(ints[0], 7);
+  EXPECT_EQ(ints[5], 1);
+}
+
+TEST(VectorBulk, RangeConstructor) {
+  std::list<std::string> source{"a", "b", "c"};
+  s21::vector<std::string> v(source.begin(), source.end());
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(v.capacity(), 3);
+  EXPECT_EQ(v[1], "b");
+
+  std::istringstream input("1 2 3 4 5");
+  s21::vector<int> ints{std::istream_iterator<int>(input),
+                        std::istream_iterator<int>()};
+  ASSERT_EQ(ints.size(), 5);
+  EXPECT_EQ(ints[4], 5);
+}
+
+TEST(VectorBulk, RangeInsertSingleReallocation) {
+  s21::vector<int> v{1, 2, 3};
+  std::vector<int> source(100);
+  for (int i = 0; i < 100; ++i) source[i] = i + 10;
+  v.insert(v.begin() + 1, source.begin(), source.end());
+  EXPECT_EQ(v.size(), 103);
+  EXPECT_EQ(v.capacity(), 103);
+  EXPECT_EQ(v[0], 1);
+  EXPECT_EQ(v[1], 10);
+  EXPECT_EQ(v[100], 109);
+  EXPECT_EQ(v[101], 2);
+  EXPECT_EQ(v[102], 3);
+}
+
+TEST(VectorBulk, RangeInsertMatchesStd) {
+  // Covers tails longer and shorter than the inserted range, in place and
+  // with reallocation, for a type using the element-wise path
+  for (std::size_t reserve : {0, 64}) {
+    for (std::size_t pos = 0; pos <= 6; ++pos) {
+      for (std::size_t count = 0; count <= 8; ++count) {
+        s21::vector<std::string> v{"0", "1", "2", "3", "4", "5"};
+        std::vector<std::string> expected{"0", "1", "2", "3", "4", "5"};
+        v.reserve(reserve);
+        std::vector<std::string> source;
+        for (std::size_t i = 0; i < count; ++i)
+          source.push_back("n" + std::to_string(i));
+        v.insert(v.begin() + pos, source.begin(), source.end());
+        expected.insert(expected.begin() + pos, source.begin(), source.end());
+        ASSERT_EQ(v.size(), expected.size());
+        for (std::size_t i = 0; i < expected.size(); ++i)
+          EXPECT_EQ(v[i], expected[i]);
+      }
+    }
+  }
+}
+
+TEST(VectorBulk, RangeInsertInPlaceTrivial) {
+  s21::vector<int> v{0, 1, 2, 3};
+  v.reserve(16);
+  const int source[] = {7, 8, 9};
+  v.insert(v.begin() + 2, source, source + 3);
+  std::vector<int> expected{0, 1, 7, 8, 9, 2, 3};
+  ASSERT_EQ(v.size(), expected.size());
+  EXPECT_EQ(v.capacity(), 16);
+  for (std::size_t i = 0; i < expected.size(); ++i)
+    EXPECT_EQ(v[i], expected[i]);
+}
+
+TEST(VectorBulk, InputIteratorInsert) {
+  s21::vector<int> v{1, 2};
+  std::istringstream input("7 8 9");
+  v.insert(v.begin() + 1, std::istream_iterator<int>(input),
+           std::istream_iterator<int>());
+  std::vector<int> expected{1, 7, 8, 9, 2};
+  ASSERT_EQ(v.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i)
+    EXPECT_EQ(v[i], expected[i]);
+}
+
+TEST(VectorBulk, InitializerListInsertAndAppend) {
+  s21::vector<int> v{1, 5};
+  v.insert(v.begin() + 1, {2, 3, 4});
+  std::list<int> tail{6, 7};
+  v.append_range(tail);
+  v.append_range(std::vector<int>{8});
+  ASSERT_EQ(v.size(), 8);
+  for (int i = 0; i < 8; ++i) EXPECT_EQ(v[i], i + 1);
+}
+
+TEST(VectorBulk, Assign) {
+  s21::vector<std::string> v{"a", "b", "c"};
+  v.assign(2, "z");
+  EXPECT_EQ(v.size(), 2);
+  EXPECT_EQ(v.capacity(), 3);
+  EXPECT_EQ(v[1], "z");
+  v.assign(5, v[0]);
+  EXPECT_EQ(v.size(), 5);
+  EXPECT_EQ(v[4], "z");
+  std::list<std::string> source{"x", "y"};
+  v.assign(source.begin(), source.end());
+  EXPECT_EQ(v.size(), 2);
+  EXPECT_EQ(v[0], "x");
+  v = {"p", "q", "r"};
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(v[2], "r");
+}
+
+TEST(VectorBulk, LifetimeIsBalanced) {
+  Tracked::alive = 0;
+  {
+    s21::vector<Tracked> v{1, 2, 3};
+    std::vector<Tracked> source{4, 5, 6, 7};
+    v.insert(v.begin() + 1, source.begin(), source.end());
+    v.insert(v.begin(), 3, Tracked(9));
+    v.assign(2, Tracked(1));
+    EXPECT_EQ(Tracked::alive, 6);
+  }
+  EXPECT_EQ(Tracked::alive, 0);
+}
+
+TEST(VectorErase, Range) {
+  s21::vector<std::string> v{"a", "b", "c", "d", "e"};
+  auto it = v.erase(v.begin() + 1, v.begin() + 3);
+  EXPECT_EQ(*it, "d");
+  ASSERT_EQ(v.size(), 3);
+  EXPECT_EQ(v[0], "a");
+  EXPECT_EQ(v[2], "e");
+  EXPECT_EQ(v.erase(v.begin(), v.begin()), v.begin());
+  it = v.erase(v.begin() + 1, v.end());
+  EXPECT_EQ(it, v.end());
+  EXPECT_EQ(v.size(), 1);
+  EXPECT_THROW(v.erase(v.begin(), v.begin() + 2), std::out_of_range);
+  EXPECT_THROW(v.erase(v.begin() + 1, v.begin()), std::out_of_range);
+}
+
+TEST(VectorErase, RangeRelocatable) {
+  s21::vector<Handle> v;
+  for (int i = 0; i < 10; ++i) v.emplace_back(i);
+  v.erase(v.begin() + 2, v.begin() + 7);
+  ASSERT_EQ(v.size(), 5);
+  const int expected[] = {0, 1, 7, 8, 9};
+  for (int i = 0; i < 5; ++i) EXPECT_EQ(*v[i].value, expected[i]);
+}
+
+TEST(VectorErase, EraseIf) {
+  s21::vector<int> v;
+  for (int i = 0; i < 100; ++i) v.push_back(i);
+  EXPECT_EQ(s21::erase_if(v, [](int x) { return x % 3 != 0; }), 66);
+  ASSERT_EQ(v.size(), 34);
+  for (std::size_t i = 0; i < v.size(); ++i) EXPECT_EQ(v[i], 3 * i);
+  EXPECT_EQ(s21::erase_if(v, [](int) { return false; }), 0);
+  EXPECT_EQ(s21::erase(v, 33), 1);
+  EXPECT_EQ(s21::erase(v, 1000), 0);
+  EXPECT_EQ(v.back(), 99);
+  s21::vector<std::string> words{"x", "y", "x", "z", "x"};
+  EXPECT_EQ(s21::erase(words, "x"), 3);
+  ASSERT_EQ(words.size(), 2);
+  EXPECT_EQ(words[0], "y");
+  EXPECT_EQ(words[1], "z");
+}
+
+TEST(VectorErase, UnorderedErase) {
+  s21::vector<std::string> v{"a", "b", "c", "d"};
+  auto it = v.unordered_erase(v.begin());
+  EXPECT_EQ(*it, "d");
+  EXPECT_EQ(v.size(), 3);
+  it = v.unordered_erase(v.end() - 1);
+  EXPECT_EQ(it, v.end());
+  EXPECT_EQ(v.size(), 2);
+  EXPECT_EQ(v[0], "d");
+  EXPECT_EQ(v[1], "b");
+  EXPECT_THROW(v.unordered_erase(v.end()), std::out_of_range);
+
+  s21::vector<Handle> handles;
+  for (int i = 0; i < 4; ++i) handles.emplace_back(i);
+  handles.unordered_erase(handles.begin() + 1);
+  EXPECT_EQ(*handles[1].value, 3);
+  handles.unordered_erase(handles.end() - 1);
+  ASSERT_EQ(handles.size(), 2);
+  EXPECT_EQ(*handles[0].value, 0);
+}
+
+TEST(VectorErase, DestroysRemovedElements) {
+  Tracked::alive = 0;
+  {
+    s21::vector<Tracked> v;
+    for (int i = 0; i < 20; ++i) v.emplace_back(i);
+    v.erase(v.begin() + 5, v.begin() + 10);
+    EXPECT_EQ(Tracked::alive, 15);
+    s21::erase_if(v, [](const Tracked &t) { return t.value % 2 == 0; });
+    EXPECT_EQ(Tracked::alive, static_cast<int>(v.size()));
+    v.unordered_erase(v.begin());
+    EXPECT_EQ(Tracked::alive, static_cast<int>(v.size()));
+  }
+  EXPECT_EQ(Tracked::alive, 0);
+}
@@ -0,0 +1,111 @@
+// Built as a separate test binary: the statistics change the layout of
+// s21::vector, so they must be enabled for every translation unit
+#define S21_VECTOR_STATS 1
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+#include "arena_allocator.h"
+#include "vector.h"
+
+namespace {
+const s21::vector_stats_record &Record(const char *tag) {
+  return s21::vector_stats::record(tag);
+}
+}  // namespace
+
+TEST(VectorStats, CountsGrowth) {
+  s21::vector_stats::reset();
+  {
+    s21::vector<int> v;
+    v.set_stats_tag("growth");
+    for (int i = 0; i < 8; ++i) v.push_back(i);
+    v.push_back(8);
+  }
+  const auto &r = Record("growth");
+  // Capacities 1, 2, 4, 8 and 16
+  EXPECT_EQ(r.allocations, 5);
+  EXPECT_EQ(r.reallocations, 4);
+  EXPECT_EQ(r.bytes_relocated, (1 + 2 + 4 + 8) * sizeof(int));
+  EXPECT_EQ(r.peak_capacity_bytes, 16 * sizeof(int));
+  EXPECT_EQ(r.wasted_capacity_bytes, 7 * sizeof(int));
+  EXPECT_EQ(r.elements_shifted, 0);
+}
+
+TEST(VectorStats, CountsShifts) {
+  s21::vector_stats::reset();
+  s21::vector<std::string> v{"a", "b", "c", "d"};
+  v.set_stats_tag("shifts");
+  v.reserve(10);
+  v.insert(v.begin(), "z");
+  v.erase(v.begin() + 1);
+  v.insert(v.begin() + 2, 2, "y");
+  const auto &r = Record("shifts");
+  EXPECT_EQ(r.elements_shifted, 4 + 3 + 2);
+  EXPECT_EQ(r.reallocations, 1);
+  EXPECT_EQ(r.allocations, 1);
+}
+
+TEST(VectorStats, CopiesKeepTag) {
+  s21::vector_stats::reset();
+  s21::vector<int> v;
+  v.set_stats_tag("copied");
+  v.reserve(4);
+  s21::vector<int> copy(v);
+  copy.push_back(1);
+  copy.shrink_to_fit();
+  EXPECT_EQ(Record("copied").allocations, 3);
+}
+
+TEST(VectorStats, ReallocateInPlace) {
+  s21::vector_stats::reset();
+  s21::monotonic_buffer buffer(1024);
+  s21::vector<int, s21::arena_allocator<int>> v{
+      s21::arena_allocator<int>(buffer)};
+  v.set_stats_tag("in_place");
+  v.reserve(4);
+  v.assign({1, 2, 3, 4});
+  // The arena grows its most recent block without moving it
+  const int *data = v.data();
+  v.push_back(5);
+  ASSERT_EQ(v.data(), data);
+  const auto &r = Record("in_place");
+  EXPECT_EQ(r.allocations, 2);
+  EXPECT_EQ(r.reallocations, 1);
+  EXPECT_EQ(r.bytes_relocated, 0);
+  EXPECT_EQ(r.peak_capacity_bytes, 8 * sizeof(int));
+}
+
+TEST(VectorStats, SwapMovesCounters) {
+  s21::vector_stats::reset();
+  s21::vector<int> a{1, 2, 3};
+  a.set_stats_tag("swap_a");
+  s21::vector<int> b;
+  b.set_stats_tag("swap_b");
+  a.swap(b);
+  // b now owns the full block of a, growing it counts for a's tag
+  b.push_back(4);
+  EXPECT_EQ(Record("swap_a").reallocations, 1);
+  EXPECT_EQ(Record("swap_b").reallocations, 0);
+  b = std::move(a);
+  b.push_back(1);
+  EXPECT_EQ(Record("swap_b").allocations, 1);
+}
+
+TEST(VectorStats, DumpJson) {
+  s21::vector_stats::reset();
+  {
+    s21::vector<int> v;
+    v.set_stats_tag(S21_VECTOR_CALL_SITE);
+    v.push_back(1);
+  }
+  std::ostringstream out;
+  s21::vector_stats::dump_json(out);
+  std::string json = out.str();
+  EXPECT_NE(json.find("test_vector_stats.cc:"), std::string::npos);
+  EXPECT_NE(json.find("\"allocations\": 1"), std::string::npos);
+  EXPECT_NE(json.find("\"wasted_capacity_bytes\""), std::string::npos);
+  EXPECT_EQ(json.front(), '{');
+}
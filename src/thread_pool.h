@@ -0,0 +1,238 @@
+#ifndef CONTAINERS_CPP_THREAD_POOL_H
+#define CONTAINERS_CPP_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// Work-stealing pool for the fork-join style of the parallel algorithms.
+// Every worker owns a deque: it runs its own tasks newest first, and when
+// that is empty it steals the oldest task of another queue. Tasks submitted
+// by threads outside the pool go to a shared queue. A thread waiting in
+// task_group::wait() runs queued tasks meanwhile, so nested waits don't
+// deadlock and a pool of n workers keeps n + 1 threads busy.
+class thread_pool {
+ public:
+  using task = std::function<void()>;
+
+ private:
+  struct alignas(64) Queue {
+    std::mutex mutex;
+    std::deque<task> tasks;
+  };
+
+  struct Current {
+    const thread_pool *pool = nullptr;
+    std::size_t index = 0;
+  };
+
+  std::vector<std::unique_ptr<Queue>> queues_;  // one per worker + shared
+  std::vector<std::thread> workers_;
+  std::atomic<std::size_t> queued_{0};
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  bool stop_ = false;
+
+  static Current &This() noexcept {
+    static thread_local Current current;
+    return current;
+  }
+
+  std::size_t SharedQueue() const noexcept { return workers_.size(); }
+
+  bool Pop(std::size_t index, bool newest, task &out) {
+    Queue &queue = *queues_[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) return false;
+    if (newest) {
+      out = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+    } else {
+      out = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+    }
+    queued_.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  // Own queue first, then the shared one, then the other workers'
+  bool Take(task &out) {
+    if (!queued_.load(std::memory_order_relaxed)) return false;
+    const std::size_t self = current_index();
+    if (self != SharedQueue() && Pop(self, true, out)) return true;
+    if (Pop(SharedQueue(), false, out)) return true;
+    for (std::size_t i = 1; i < queues_.size(); ++i) {
+      std::size_t victim = (self + i) % queues_.size();
+      if (victim != SharedQueue() && Pop(victim, false, out)) return true;
+    }
+    return false;
+  }
+
+  void Work(std::size_t index) {
+    This() = Current{this, index};
+    task job;
+    while (true) {
+      if (Take(job)) {
+        job();
+        job = nullptr;
+        continue;
+      }
+      // Bounded, so an idle worker looks around once in a while anyway
+      std::unique_lock<std::mutex> lock(sleep_mutex_);
+      wake_.wait_for(lock, std::chrono::milliseconds(100), [this] {
+        return stop_ || queued_.load(std::memory_order_relaxed) > 0;
+      });
+      if (stop_ && !queued_.load(std::memory_order_relaxed)) return;
+    }
+  }
+
+ public:
+  // Workers besides the threads that wait for tasks: one less than the
+  // hardware threads
+  static std::size_t default_workers() noexcept {
+    unsigned hardware = std::thread::hardware_concurrency();
+    return hardware > 1 ? hardware - 1 : 0;
+  }
+
+  explicit thread_pool(std::size_t workers = default_workers()) {
+    for (std::size_t i = 0; i <= workers; ++i)
+      queues_.push_back(std::make_unique<Queue>());
+    workers_.reserve(workers);
+    try {
+      for (std::size_t i = 0; i < workers; ++i)
+        workers_.emplace_back(&thread_pool::Work, this, i);
+    } catch (...) {
+      Stop();
+      throw;
+    }
+  }
+
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+
+  // Runs the tasks still queued, then joins the workers
+  ~thread_pool() { Stop(); }
+
+  // The pool the parallel algorithms use unless told otherwise
+  static thread_pool &default_pool() {
+    static thread_pool pool;
+    return pool;
+  }
+
+  std::size_t size() const noexcept { return workers_.size(); }
+
+  // Threads running tasks while one of them waits for a task_group
+  std::size_t concurrency() const noexcept { return workers_.size() + 1; }
+
+  // Index of the calling worker of this pool, size() for other threads
+  std::size_t current_index() const noexcept {
+    return This().pool == this ? This().index : SharedQueue();
+  }
+
+  template <class F>
+  void submit(F &&f) {
+    Queue &queue = *queues_[current_index()];
+    {
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      queue.tasks.emplace_back(std::forward<F>(f));
+    }
+    queued_.fetch_add(1, std::memory_order_relaxed);
+    // Taking the mutex orders the count before a worker's check to sleep
+    { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+    wake_.notify_one();
+  }
+
+  // Runs one queued task on the calling thread, false if there was none
+  bool run_pending() {
+    task job;
+    if (!Take(job)) return false;
+    job();
+    return true;
+  }
+
+ private:
+  void Stop() noexcept {
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread &worker : workers_)
+      if (worker.joinable()) worker.join();
+    while (run_pending()) {
+    }
+  }
+};
+
+// Tasks forked on a pool and joined by wait(). The first exception a task
+// throws is rethrown by wait(), the other tasks still run to the end.
+class task_group {
+ private:
+  thread_pool &pool_;
+  std::atomic<std::size_t> pending_{0};
+  std::mutex error_mutex_;
+  std::exception_ptr error_;
+
+  void WaitTasks() noexcept {
+    while (pending_.load(std::memory_order_acquire)) {
+      if (!pool_.run_pending()) std::this_thread::yield();
+    }
+  }
+
+ public:
+  explicit task_group(thread_pool &pool = thread_pool::default_pool())
+      : pool_(pool) {}
+
+  task_group(const task_group &) = delete;
+  task_group &operator=(const task_group &) = delete;
+
+  // The tasks refer to the group, it can't go before they finish
+  ~task_group() { WaitTasks(); }
+
+  thread_pool &pool() const noexcept { return pool_; }
+
+  template <class F>
+  void run(F &&f) {
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    try {
+      pool_.submit([this, f = std::forward<F>(f)]() mutable {
+        try {
+          f();
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(error_mutex_);
+          if (!error_) error_ = std::current_exception();
+        }
+        pending_.fetch_sub(1, std::memory_order_release);
+      });
+    } catch (...) {
+      pending_.fetch_sub(1, std::memory_order_relaxed);
+      throw;
+    }
+  }
+
+  void wait() {
+    WaitTasks();
+    std::exception_ptr error;
+    {
+      std::lock_guard<std::mutex> lock(error_mutex_);
+      std::swap(error, error_);
+    }
+    if (error) std::rethrow_exception(error);
+  }
+};
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_THREAD_POOL_H
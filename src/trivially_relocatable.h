@@ -0,0 +1,44 @@
+#ifndef CONTAINERS_CPP_TRIVIALLY_RELOCATABLE_H
+#define CONTAINERS_CPP_TRIVIALLY_RELOCATABLE_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Customization point: a type is trivially relocatable when moving an
+// object to new storage and destroying the source is equivalent to copying
+// its bytes. Containers then relocate such elements with memcpy/memmove.
+// Trivially copyable types qualify out of the box, other types (e.g. ones
+// owning a heap pointer) may opt in by specializing this template:
+//
+//   template <>
+//   struct s21::is_trivially_relocatable<Handle> : std::true_type {};
+template <class T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template <class T>
+inline constexpr bool is_trivially_relocatable_v =
+    is_trivially_relocatable<T>::value;
+
+// Detects the optional allocator extension
+//   T *reallocate(T *ptr, size_type old_count, size_type new_count)
+// which resizes a block holding trivially relocatable objects, keeping its
+// first old_count elements, in place when the allocator is able to.
+template <class Allocator, class = void>
+struct has_reallocate : std::false_type {};
+
+template <class Allocator>
+struct has_reallocate<
+    Allocator,
+    std::void_t<decltype(std::declval<Allocator &>().reallocate(
+        std::declval<typename Allocator::value_type *>(), std::size_t{},
+        std::size_t{}))>> : std::true_type {};
+
+template <class Allocator>
+inline constexpr bool has_reallocate_v = has_reallocate<Allocator>::value;
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_TRIVIALLY_RELOCATABLE_H
@@ -1,20 +1,32 @@
 #ifndef CONTAINERS_CPP_VECTOR_H
 #define CONTAINERS_CPP_VECTOR_H
 
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <initializer_list>
 #include <iterator>
 #include <limits>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#include "growth_policy.h"
+#include "hardening.h"
+#include "trivially_relocatable.h"
+#include "vector_stats.h"
+
 namespace s21 {
 
-template <class T>
+template <class T, class Allocator = std::allocator<T>,
+          class GrowthPolicy = growth::doubling>
 class vector {
  public:
   // Member types
   using value_type = T;
+  using allocator_type = Allocator;
+  using growth_policy = GrowthPolicy;
   using reference = T &;
   using const_reference = const T &;
   using iterator = T *;
@@ -22,80 +34,484 @@ class vector {
   using size_type = std::size_t;
 
  private:
+  using alloc_traits = std::allocator_traits<allocator_type>;
+
+  static_assert(std::is_same_v<typename alloc_traits::value_type, T>,
+                "s21::vector Allocator::value_type must be the same as T");
+  static_assert(std::is_same_v<typename alloc_traits::pointer, T *>,
+                "s21::vector Allocator must use plain pointers");
+
+  template <class It>
+  using IteratorCategory =
+      typename std::iterator_traits<It>::iterator_category;
+
+  template <class It>
+  using RequireInputIterator = std::enable_if_t<
+      std::is_convertible_v<IteratorCategory<It>, std::input_iterator_tag>>;
+
+  template <class It>
+  static constexpr bool kIsForwardIterator =
+      std::is_convertible_v<IteratorCategory<It>, std::forward_iterator_tag>;
+  // Forward iterator repeating a single value, it lets
+  // insert(pos, count, value) share the range insertion code
+  struct FillIterator {
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T *;
+    using reference = const T &;
+
+    const T *value;
+
+    reference operator*() const noexcept { return *value; }
+    FillIterator &operator++() noexcept { return *this; }
+    FillIterator operator++(int) noexcept { return *this; }
+  };
+
+  template <class A, class = void>
+  struct HasConstruct : std::false_type {};
+
+  template <class A>
+  struct HasConstruct<A, std::void_t<decltype(std::declval<A &>().construct(
+                             std::declval<T *>(), std::declval<const T &>()))>>
+      : std::true_type {};
+  // Copies may bypass allocator_traits::construct, which lets the standard
+  // algorithms lower them to memmove
+  static constexpr bool kPlainCopy =
+      std::is_trivially_copyable_v<T> &&
+      (std::is_same_v<Allocator, std::allocator<T>> ||
+       !HasConstruct<Allocator>::value);
+
   size_type size_ = 0;
   size_type capacity_ = 0;
   iterator array_ = nullptr;
+  [[no_unique_address]] allocator_type alloc_{};
+  [[no_unique_address]] vector_stats_handle<S21_VECTOR_STATS> stats_;
+  // Helper functions to obtain and release raw, uninitialized storage.
+  // Only the elements in [0, size_) are ever alive.
+  iterator Allocate(size_type count) {
+    if (!count) return nullptr;
+    stats_.on_allocate(count * sizeof(value_type));
+    return alloc_traits::allocate(alloc_, count);
+  }
+
+  void Deallocate(iterator ptr, size_type count) noexcept {
+    if (ptr) alloc_traits::deallocate(alloc_, ptr, count);
+  }
+
+  void Destroy(iterator first, iterator last) noexcept {
+    for (; first != last; ++first) alloc_traits::destroy(alloc_, first);
+  }
+  // Destroys every element and gives the storage back to the allocator
+  void Release() noexcept {
+    if (array_) stats_.on_release((capacity_ - size_) * sizeof(value_type));
+    Destroy(begin(), end());
+    Deallocate(array_, capacity_);
+    array_ = nullptr;
+    size_ = 0;
+    capacity_ = 0;
+  }
+  // Copy constructs [first, last) into raw storage, on exception everything
+  // constructed so far is destroyed again
+  template <class InputIt>
+  iterator UninitializedCopy(InputIt first, InputIt last, iterator dest) {
+    if constexpr (kPlainCopy) {
+      return std::uninitialized_copy(first, last, dest);
+    } else {
+      iterator current = dest;
+      try {
+        for (; first != last; ++first, ++current)
+          alloc_traits::construct(alloc_, current, *first);
+      } catch (...) {
+        Destroy(dest, current);
+        throw;
+      }
+      return current;
+    }
+  }
+
+  template <class ForwardIt>
+  iterator UninitializedCopyN(ForwardIt first, size_type count,
+                              iterator dest) {
+    if constexpr (kPlainCopy) {
+      return std::uninitialized_copy_n(first, count, dest);
+    } else {
+      iterator current = dest;
+      try {
+        for (; count; --count, ++first, ++current)
+          alloc_traits::construct(alloc_, current, *first);
+      } catch (...) {
+        Destroy(dest, current);
+        throw;
+      }
+      return current;
+    }
+  }
+
+  iterator UninitializedValue(iterator dest, size_type count) {
+    iterator current = dest;
+    try {
+      for (; count; --count, ++current)
+        alloc_traits::construct(alloc_, current);
+    } catch (...) {
+      Destroy(dest, current);
+      throw;
+    }
+    return current;
+  }
+  // Moves (or copies, if moving may throw) [first, last) into raw storage
+  iterator Relocate(iterator first, iterator last, iterator dest) {
+    if constexpr (std::is_nothrow_move_constructible_v<value_type> ||
+                  !std::is_copy_constructible_v<value_type>) {
+      return UninitializedCopy(std::make_move_iterator(first),
+                               std::make_move_iterator(last), dest);
+    } else {
+      return UninitializedCopy(first, last, dest);
+    }
+  }
   // Helper function to reallocate memory
   void ReallocVec(size_type new_capacity_) {
-    iterator tmp = new value_type[new_capacity_];
-    for (size_type i = 0; i < size_; ++i) tmp[i] = std::move(array_[i]);
+    if constexpr (is_trivially_relocatable_v<value_type> &&
+                  has_reallocate_v<allocator_type>) {
+      if (array_ && new_capacity_) {
+        iterator old = array_;
+        array_ = alloc_.reallocate(array_, capacity_, new_capacity_);
+        capacity_ = new_capacity_;
+        // A block resized in place relocated nothing
+        stats_.on_allocate(capacity_ * sizeof(value_type));
+        stats_.on_reallocate(array_ == old ? 0 : size_ * sizeof(value_type));
+        return;
+      }
+    }
+    if (array_) stats_.on_reallocate(size_ * sizeof(value_type));
+    if constexpr (is_trivially_relocatable_v<value_type>) {
+      iterator tmp = Allocate(new_capacity_);
+      if (size_)
+        std::memcpy(static_cast<void *>(tmp), array_,
+                    size_ * sizeof(value_type));
+      Deallocate(array_, capacity_);
+      array_ = tmp;
+    } else {
+      iterator tmp = Allocate(new_capacity_);
+      try {
+        Relocate(array_, array_ + size_, tmp);
+      } catch (...) {
+        Deallocate(tmp, new_capacity_);
+        throw;
+      }
+      Destroy(begin(), end());
+      Deallocate(array_, capacity_);
+      array_ = tmp;
+    }
+    capacity_ = new_capacity_;
+  }
 
-    delete[] array_;
+  // Capacity to grow to when extra more elements don't fit
+  size_type NextCapacity(size_type extra = 1) const {
+    if (extra > max_size() - size_)
+      throw std::length_error(
+          "s21::vector Capacity can't grow beyond Vector<T>::max_size()");
+
+    return std::min<size_type>(
+        GrowthPolicy::next_capacity(size_, size_ + extra, sizeof(value_type)),
+        max_size());
+  }
+  // Moves the elements into tmp, a new block whose [pos, pos + count) is
+  // already constructed, and makes it the storage of the vector. On
+  // exception tmp is freed and the vector is left untouched
+  void AdoptAround(iterator tmp, size_type new_capacity_, size_type pos,
+                   size_type count) {
+    if (array_) stats_.on_reallocate(size_ * sizeof(value_type));
+    if constexpr (is_trivially_relocatable_v<value_type>) {
+      if (pos)
+        std::memcpy(static_cast<void *>(tmp), array_,
+                    pos * sizeof(value_type));
+      if (size_ - pos)
+        std::memcpy(static_cast<void *>(tmp + pos + count), array_ + pos,
+                    (size_ - pos) * sizeof(value_type));
+    } else {
+      iterator done = tmp;
+      try {
+        done = Relocate(array_, array_ + pos, tmp);
+        Relocate(array_ + pos, end(), tmp + pos + count);
+      } catch (...) {
+        Destroy(tmp, done);
+        Destroy(tmp + pos, tmp + pos + count);
+        Deallocate(tmp, new_capacity_);
+        throw;
+      }
+      Destroy(begin(), end());
+    }
+    Deallocate(array_, capacity_);
     array_ = tmp;
     capacity_ = new_capacity_;
+    size_ += count;
+  }
+  // Grows into a new block and constructs the element at index pos there
+  // before the old elements are relocated, so args may still refer to
+  // elements of the old block
+  template <class... Args>
+  void EmplaceRealloc(size_type pos, Args &&...args) {
+    size_type new_capacity_ = NextCapacity();
+    iterator tmp = Allocate(new_capacity_);
+    try {
+      alloc_traits::construct(alloc_, tmp + pos, std::forward<Args>(args)...);
+    } catch (...) {
+      Deallocate(tmp, new_capacity_);
+      throw;
+    }
+    AdoptAround(tmp, new_capacity_, pos, 1);
+  }
+  // Copies count elements starting at first into index pos with at most
+  // one reallocation and one shift of the tail
+  template <class ForwardIt>
+  void InsertRange(size_type pos, ForwardIt first, size_type count) {
+    if (!count) return;
+
+    if (count > capacity_ - size_) {
+      size_type new_capacity_ = NextCapacity(count);
+      iterator tmp = Allocate(new_capacity_);
+      try {
+        UninitializedCopyN(first, count, tmp + pos);
+      } catch (...) {
+        Deallocate(tmp, new_capacity_);
+        throw;
+      }
+      AdoptAround(tmp, new_capacity_, pos, count);
+    } else if constexpr (is_trivially_relocatable_v<value_type>) {
+      stats_.on_shift(size_ - pos);
+      iterator gap = array_ + pos;
+      std::memmove(static_cast<void *>(gap + count), gap,
+                   (size_ - pos) * sizeof(value_type));
+      try {
+        UninitializedCopyN(first, count, gap);
+      } catch (...) {
+        std::memmove(static_cast<void *>(gap), gap + count,
+                     (size_ - pos) * sizeof(value_type));
+        throw;
+      }
+      size_ += count;
+    } else {
+      stats_.on_shift(size_ - pos);
+      iterator gap = begin() + pos;
+      iterator old_end = end();
+      size_type after = size_ - pos;
+      if (after > count) {
+        UninitializedCopy(std::make_move_iterator(old_end - count),
+                          std::make_move_iterator(old_end), old_end);
+        size_ += count;
+        std::move_backward(gap, old_end - count, old_end);
+        std::copy_n(first, count, gap);
+      } else {
+        ForwardIt mid = std::next(first, after);
+        UninitializedCopyN(mid, count - after, old_end);
+        size_ += count - after;
+        UninitializedCopy(std::make_move_iterator(gap),
+                          std::make_move_iterator(old_end), end());
+        size_ += after;
+        std::copy_n(first, after, gap);
+      }
+    }
+  }
+
+  // Inserts value at index pos, capacity for one more element must be
+  // available and value must not refer to an element of this vector
+  void InsertAt(size_type pos, value_type &&value) {
+    stats_.on_shift(size_ - pos);
+    if constexpr (is_trivially_relocatable_v<value_type>) {
+      // Relocated bytes leave a dead slot to construct the new element in
+      std::memmove(static_cast<void *>(array_ + pos + 1), array_ + pos,
+                   (size_ - pos) * sizeof(value_type));
+      try {
+        alloc_traits::construct(alloc_, array_ + pos, std::move(value));
+      } catch (...) {
+        std::memmove(static_cast<void *>(array_ + pos), array_ + pos + 1,
+                     (size_ - pos) * sizeof(value_type));
+        throw;
+      }
+    } else if (pos == size_) {
+      alloc_traits::construct(alloc_, end(), std::move(value));
+    } else {
+      alloc_traits::construct(alloc_, end(), std::move(*(end() - 1)));
+      std::move_backward(begin() + pos, end() - 1, end());
+      array_[pos] = std::move(value);
+    }
+    ++size_;
+  }
+
+  void SwapStorage(vector &other) noexcept {
+    std::swap(array_, other.array_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
   }
 
  public:
   // Constructors
-  vector() {}
+  vector() noexcept(noexcept(Allocator())) {}
+
+  explicit vector(const Allocator &alloc) noexcept : alloc_{alloc} {}
 
-  explicit vector(size_type size) {
+  explicit vector(size_type size, const Allocator &alloc = Allocator())
+      : alloc_{alloc} {
+    if (size) {
+      array_ = Allocate(size);
+      try {
+        UninitializedValue(array_, size);
+      } catch (...) {
+        Deallocate(array_, size);
+        throw;
+      }
+    }
     size_ = size;
     capacity_ = size;
-    array_ = nullptr;
-    if (size) {
-      array_ = new value_type[capacity_];
+  }
+
+  vector(size_type count, const_reference value,
+         const Allocator &alloc = Allocator())
+      : alloc_{alloc} {
+    InsertRange(0, FillIterator{&value}, count);
+  }
+
+  template <class InputIt, class = RequireInputIterator<InputIt>>
+  vector(InputIt first, InputIt last, const Allocator &alloc = Allocator())
+      : alloc_{alloc} {
+    if constexpr (kIsForwardIterator<InputIt>) {
+      InsertRange(0, first, std::distance(first, last));
+    } else {
+      try {
+        for (; first != last; ++first) emplace_back(*first);
+      } catch (...) {
+        Release();
+        throw;
+      }
     }
   }
 
-  vector(std::initializer_list<value_type> const &init)
-      : size_{init.size()},
-        capacity_{init.size()},
-        array_{new value_type[capacity_]} {
-    std::copy(init.begin(), init.end(), array_);
+  vector(std::initializer_list<value_type> const &init,
+         const Allocator &alloc = Allocator())
+      : alloc_{alloc} {
+    array_ = Allocate(init.size());
+    try {
+      UninitializedCopy(init.begin(), init.end(), array_);
+    } catch (...) {
+      Deallocate(array_, init.size());
+      throw;
+    }
+    size_ = init.size();
+    capacity_ = init.size();
   }
 
-  vector(const vector &vec) {
+  vector(const vector &vec, const Allocator &alloc)
+      : alloc_{alloc}, stats_{vec.stats_} {
+    array_ = Allocate(vec.capacity_);
+    try {
+      UninitializedCopy(vec.begin(), vec.end(), array_);
+    } catch (...) {
+      Deallocate(array_, vec.capacity_);
+      throw;
+    }
     size_ = vec.size_;
     capacity_ = vec.capacity_;
-    array_ = nullptr;
-    if (size_) {
-      array_ = new value_type[capacity_];
-    }
-    std::copy(vec.begin(), vec.end(), array_);
   }
 
-  vector(vector &&vec) noexcept {
+  vector(const vector &vec)
+      : vector(vec, alloc_traits::select_on_container_copy_construction(
+                        vec.alloc_)) {}
+
+  vector(vector &&vec) noexcept
+      : alloc_{std::move(vec.alloc_)}, stats_{vec.stats_} {
     size_ = std::exchange(vec.size_, 0);
     capacity_ = std::exchange(vec.capacity_, 0);
     array_ = std::exchange(vec.array_, nullptr);
   }
+
+  vector(vector &&vec, const Allocator &alloc)
+      : alloc_{alloc}, stats_{vec.stats_} {
+    if (alloc_traits::is_always_equal::value || alloc_ == vec.alloc_) {
+      SwapStorage(vec);
+    } else if (vec.size_) {
+      array_ = Allocate(vec.size_);
+      try {
+        UninitializedCopy(std::make_move_iterator(vec.begin()),
+                          std::make_move_iterator(vec.end()), array_);
+      } catch (...) {
+        Deallocate(array_, vec.size_);
+        throw;
+      }
+      size_ = vec.size_;
+      capacity_ = vec.size_;
+    }
+  }
   // Destructor
-  ~vector() { delete[] array_; }
+  ~vector() { Release(); }
   // Move assignment operator
-  constexpr vector &operator=(vector &&vec) noexcept {
-    if (this != &vec) {
-      size_ = std::exchange(vec.size_, 0);
-      capacity_ = std::exchange(vec.capacity_, 0);
-      array_ = std::exchange(vec.array_, nullptr);
+  constexpr vector &operator=(vector &&vec) noexcept(
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value) {
+    if (this == &vec) return *this;
+
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                      value) {
+      Release();
+      alloc_ = std::move(vec.alloc_);
+      SwapStorage(vec);
+      std::swap(stats_, vec.stats_);
+    } else if (alloc_traits::is_always_equal::value || alloc_ == vec.alloc_) {
+      Release();
+      SwapStorage(vec);
+      std::swap(stats_, vec.stats_);
+    } else {
+      // Storage owned by a foreign allocator can't be adopted
+      vector tmp(std::move(vec), alloc_);
+      SwapStorage(tmp);
     }
     return *this;
   }
   // Copy assignment operator
   constexpr vector &operator=(const vector &vec) {
-    if (this != &vec) {
-      delete[] array_;
+    if (this == &vec) return *this;
 
-      if (vec.size_) {
-        array_ = new value_type[vec.capacity_];
-        std::copy(vec.begin(), vec.end(), array_);
-      }
-      size_ = vec.size_;
-      capacity_ = vec.capacity_;
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::
+                      value) {
+      if (alloc_ != vec.alloc_) Release();
+      alloc_ = vec.alloc_;
     }
+    vector tmp(vec, alloc_);
+    SwapStorage(tmp);
     return *this;
   }
 
+  vector &operator=(std::initializer_list<value_type> init) {
+    assign(init);
+    return *this;
+  }
+
+  void assign(size_type count, const_reference value) {
+    // value may refer to an element that clear() destroys
+    value_type local(value);
+    clear();
+    InsertRange(0, FillIterator{&local}, count);
+  }
+
+  template <class InputIt, class = RequireInputIterator<InputIt>>
+  void assign(InputIt first, InputIt last) {
+    clear();
+    if constexpr (kIsForwardIterator<InputIt>) {
+      InsertRange(0, first, std::distance(first, last));
+    } else {
+      for (; first != last; ++first) emplace_back(*first);
+    }
+  }
+
+  void assign(std::initializer_list<value_type> init) {
+    assign(init.begin(), init.end());
+  }
+
+  allocator_type get_allocator() const noexcept { return alloc_; }
+  // Groups the statistics of this vector under tag, a no-op unless
+  // S21_VECTOR_STATS is enabled (see vector_stats.h)
+  void set_stats_tag(const char *tag) { stats_.set_tag(tag); }
+
   constexpr iterator begin() noexcept { return array_; }
 
   constexpr const_iterator begin() const noexcept { return array_; }
@@ -118,43 +534,37 @@ class vector {
     return array_[pos];
   }
 
-  constexpr reference operator[](size_type pos) { return at(pos); }
-
-  constexpr const_reference operator[](size_type pos) const { return at(pos); }
-  constexpr reference front() {
-    if (!size_)
-      throw std::out_of_range(
-          "s21::vector::front Using methods on a "
-          "zero sized container results ");
-
-    return *begin();
+  // Unchecked, see hardening.h for the debug/hardened precondition check
+  constexpr reference operator[](size_type pos) noexcept {
+    S21_VECTOR_ASSERT(pos < size_,
+                      "s21::vector::operator[] The index is out of range");
+    return array_[pos];
   }
 
-  constexpr const_reference front() const {
-    if (!size_)
-      throw std::out_of_range(
-          "s21::vector::front Using methods on a "
-          "zero sized container results ");
-
-    return *begin();
+  constexpr const_reference operator[](size_type pos) const noexcept {
+    S21_VECTOR_ASSERT(pos < size_,
+                      "s21::vector::operator[] The index is out of range");
+    return array_[pos];
   }
 
-  constexpr reference back() {
-    if (!size_)
-      throw std::out_of_range(
-          "s21::vector::back Using methods on a "
-          "zero sized container results ");
+  constexpr reference front() noexcept {
+    S21_VECTOR_ASSERT(size_, "s21::vector::front Called on an empty container");
+    return array_[0];
+  }
 
-    return *std::prev(end());
+  constexpr const_reference front() const noexcept {
+    S21_VECTOR_ASSERT(size_, "s21::vector::front Called on an empty container");
+    return array_[0];
   }
 
-  constexpr const_reference back() const {
-    if (!size_)
-      throw std::out_of_range(
-          "s21::vector::back Using methods on a "
-          "zero sized container results ");
+  constexpr reference back() noexcept {
+    S21_VECTOR_ASSERT(size_, "s21::vector::back Called on an empty container");
+    return array_[size_ - 1];
+  }
 
-    return *std::prev(end());
+  constexpr const_reference back() const noexcept {
+    S21_VECTOR_ASSERT(size_, "s21::vector::back Called on an empty container");
+    return array_[size_ - 1];
   }
 
   constexpr iterator data() noexcept { return array_; }
@@ -168,7 +578,9 @@ class vector {
   }
 
   [[nodiscard]] constexpr size_type max_size() const noexcept {
-    return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+    return std::min<size_type>(
+        alloc_traits::max_size(alloc_),
+        std::numeric_limits<size_type>::max() / sizeof(value_type) / 2);
   }
 
   constexpr void reserve(size_type new_capacity_) {
@@ -182,6 +594,29 @@ class vector {
     ReallocVec(new_capacity_);
   }
 
+  // reserve() allocates exactly the requested capacity, reserve_exact() is
+  // a synonym to make that explicit next to reserve_at_least()
+  constexpr void reserve_exact(size_type new_capacity_) {
+    reserve(new_capacity_);
+  }
+  // Allocates room for at least new_capacity_ elements, rounded the way
+  // GrowthPolicy grows, so a following growth step may be saved
+  constexpr void reserve_at_least(size_type new_capacity_) {
+    if (new_capacity_ <= capacity_) return;
+
+    if (new_capacity_ > max_size())
+      throw std::length_error(
+          "s21::vector::reserve_at_least Reserve capacity can't be larger "
+          "than Vector<T>::max_size()");
+
+    ReallocVec(std::min<size_type>(
+        std::max<size_type>(
+            GrowthPolicy::next_capacity(size_, new_capacity_,
+                                        sizeof(value_type)),
+            new_capacity_),
+        max_size()));
+  }
+
   constexpr size_type capacity() const noexcept { return capacity_; }
 
   constexpr void shrink_to_fit() {
@@ -190,7 +625,10 @@ class vector {
     ReallocVec(size_);
   }
 
-  constexpr void clear() noexcept { size_ = 0; }
+  constexpr void clear() noexcept {
+    Destroy(begin(), end());
+    size_ = 0;
+  }
 
   constexpr iterator insert(const_iterator pos, value_type &&value) {
     size_type tmp = pos - begin();
@@ -199,18 +637,12 @@ class vector {
           "s21::vector::insert Unable to insert into a position out of "
           "range of begin() to end()");
 
-    if (size_ == capacity_) {
-      if (size_) {
-        ReallocVec(size_ * 2);
-      } else {
-        ReallocVec(1);
-      }
+    if (tmp != size_ && size_ != capacity_) {
+      // An rvalue can't alias an element, no temporary is needed
+      InsertAt(tmp, std::move(value));
+      return begin() + tmp;
     }
-    std::copy(begin() + tmp, end(), begin() + tmp + 1);
-    *(array_ + tmp) = std::move(value);
-
-    ++size_;
-    return begin() + tmp;
+    return emplace(pos, std::move(value));
   }
 
   constexpr iterator insert(const_iterator pos, const_reference value) {
@@ -220,17 +652,92 @@ class vector {
           "s21::vector::insert Unable to insert into a position out of "
           "range of begin() to end()");
 
-    if (size_ == capacity_) {
-      if (size_) {
-        ReallocVec(size_ * 2);
-      } else {
-        ReallocVec(1);
-      }
+    return emplace(pos, value);
+  }
+
+  iterator insert(const_iterator pos, size_type count, const_reference value) {
+    size_type tmp = pos - begin();
+    if (tmp > size_)
+      throw std::out_of_range(
+          "s21::vector::insert Unable to insert into a position out of "
+          "range of begin() to end()");
+
+    // value may refer to an element that the shift or reallocation moves
+    value_type local(value);
+    InsertRange(tmp, FillIterator{&local}, count);
+    return begin() + tmp;
+  }
+  // The source range must not be part of this vector
+  template <class InputIt, class = RequireInputIterator<InputIt>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    size_type tmp = pos - begin();
+    if (tmp > size_)
+      throw std::out_of_range(
+          "s21::vector::insert Unable to insert into a position out of "
+          "range of begin() to end()");
+
+    if constexpr (kIsForwardIterator<InputIt>) {
+      InsertRange(tmp, first, std::distance(first, last));
+    } else if (tmp == size_) {
+      for (; first != last; ++first) emplace_back(*first);
+    } else {
+      // Single pass input is buffered to learn its length first
+      vector buffer(first, last, alloc_);
+      InsertRange(tmp, std::make_move_iterator(buffer.begin()),
+                  buffer.size());
     }
-    std::copy(begin() + tmp, end(), begin() + tmp + 1);
-    *(array_ + tmp) = value;
+    return begin() + tmp;
+  }
 
-    ++size_;
+  iterator insert(const_iterator pos, std::initializer_list<value_type> init) {
+    return insert(pos, init.begin(), init.end());
+  }
+
+  template <class Range>
+  void append_range(Range &&range) {
+    insert(end(), std::begin(range), std::end(range));
+  }
+  // Makes room for count elements, lets op(data(), count) write them and
+  // keeps the first op returns (at most count). Like
+  // std::basic_string::resize_and_overwrite, the elements past size() are
+  // handed to op uninitialized, so T has to be trivially copyable. Default
+  // member initializers don't matter, op overwrites what it keeps
+  template <class Operation>
+  void resize_and_overwrite(size_type count, Operation op) {
+    static_assert(std::is_trivially_copyable_v<value_type>,
+                  "s21::vector::resize_and_overwrite T must be trivially "
+                  "copyable");
+    if (count > capacity_) {
+      if (count > max_size())
+        throw std::length_error(
+            "s21::vector::resize_and_overwrite Size can't be larger than "
+            "Vector<T>::max_size()");
+      ReallocVec(NextCapacity(count - size_));
+    }
+    size_type new_size = static_cast<size_type>(std::move(op)(array_, count));
+    S21_VECTOR_ASSERT(new_size <= count,
+                      "s21::vector::resize_and_overwrite op returned a size "
+                      "larger than count");
+    size_ = new_size;
+  }
+
+  template <class... Args>
+  constexpr iterator emplace(const_iterator pos, Args &&...args) {
+    size_type tmp = pos - begin();
+    if (tmp > size_)
+      throw std::out_of_range(
+          "s21::vector::emplace Unable to emplace into a position out of "
+          "range of begin() to end()");
+
+    if (tmp == size_) {
+      emplace_back(std::forward<Args>(args)...);
+    } else if (size_ == capacity_) {
+      EmplaceRealloc(tmp, std::forward<Args>(args)...);
+    } else {
+      // args may refer to an element that the shift moves
+      value_type local(std::forward<Args>(args)...);
+      InsertAt(tmp, std::move(local));
+    }
     return begin() + tmp;
   }
 
@@ -241,35 +748,90 @@ class vector {
           "s21::vector::erase Unable to erase a position out of range of "
           "begin() to end()");
 
-    std::copy(begin(), pos, array_);
-    std::copy(pos + 1, end(), array_ + tmp);
-
+    stats_.on_shift(size_ - tmp - 1);
+    if constexpr (is_trivially_relocatable_v<value_type>) {
+      alloc_traits::destroy(alloc_, pos);
+      std::memmove(static_cast<void *>(pos), pos + 1,
+                   (size_ - tmp - 1) * sizeof(value_type));
+    } else {
+      std::move(pos + 1, end(), pos);
+      alloc_traits::destroy(alloc_, end() - 1);
+    }
     --size_;
     return begin() + tmp;
   }
 
-  constexpr void push_back(const_reference value) {
-    if (size_ == capacity_) {
-      if (size_) {
-        reserve(size_ * 2);
-      } else {
-        reserve(1);
-      }
+  // Removes [first, last) with a single shift of the tail
+  constexpr iterator erase(const_iterator first, const_iterator last) {
+    size_type from = first - begin();
+    size_type to = last - begin();
+    if (from > to || to > size_)
+      throw std::out_of_range(
+          "s21::vector::erase Unable to erase a range out of range of "
+          "begin() to end()");
+    if (from == to) return begin() + from;
+
+    size_type count = to - from;
+    stats_.on_shift(size_ - to);
+    if constexpr (is_trivially_relocatable_v<value_type>) {
+      Destroy(begin() + from, begin() + to);
+      std::memmove(static_cast<void *>(begin() + from), begin() + to,
+                   (size_ - to) * sizeof(value_type));
+    } else {
+      std::move(begin() + to, end(), begin() + from);
+      Destroy(end() - count, end());
     }
-    array_[size_] = std::move(value);
-    ++size_;
+    size_ -= count;
+    return begin() + from;
   }
 
+  // Removes the element at pos in O(1) by moving the last element into
+  // its place, so the order of the elements isn't kept. Returns pos, which
+  // then holds the former last element, or end() if pos was the last
+  constexpr iterator unordered_erase(const_iterator pos) {
+    size_type tmp = pos - begin();
+    if (tmp >= size_)
+      throw std::out_of_range(
+          "s21::vector::unordered_erase Unable to erase a position out of "
+          "range of begin() to end()");
+
+    iterator hole = begin() + tmp;
+    iterator last = end() - 1;
+    if constexpr (is_trivially_relocatable_v<value_type>) {
+      alloc_traits::destroy(alloc_, hole);
+      if (hole != last)
+        std::memcpy(static_cast<void *>(hole), last, sizeof(value_type));
+    } else {
+      if (hole != last) *hole = std::move(*last);
+      alloc_traits::destroy(alloc_, last);
+    }
+    --size_;
+    return hole;
+  }
+
+  constexpr void push_back(const_reference value) { emplace_back(value); }
+
   constexpr void push_back(value_type &&value) {
-    if (size_ == capacity_) {
-      if (size_) {
-        reserve(size_ * 2);
-      } else {
-        reserve(1);
-      }
+    emplace_back(std::move(value));
+  }
+
+  template <class... Args>
+  constexpr reference emplace_back(Args &&...args) {
+    if (size_ != capacity_) {
+      alloc_traits::construct(alloc_, end(), std::forward<Args>(args)...);
+      ++size_;
+    } else if constexpr (is_trivially_relocatable_v<value_type> &&
+                         has_reallocate_v<allocator_type>) {
+      // reallocate() may release the old block that args refer to, the
+      // element is built first to keep the in place growth
+      value_type local(std::forward<Args>(args)...);
+      ReallocVec(NextCapacity());
+      alloc_traits::construct(alloc_, end(), std::move(local));
+      ++size_;
+    } else {
+      EmplaceRealloc(size_, std::forward<Args>(args)...);
     }
-    array_[size_] = std::move(value);
-    ++size_;
+    return *(end() - 1);
   }
 
   constexpr void pop_back() {
@@ -277,15 +839,42 @@ class vector {
       throw std::length_error(
           "s21::vector::pop_back Calling pop_back on an empty container");
     --size_;
+    alloc_traits::destroy(alloc_, end());
   }
 
   constexpr void swap(vector &other) noexcept {
-    std::swap(array_, other.array_);
-    std::swap(size_, other.size_);
-    std::swap(capacity_, other.capacity_);
+    if constexpr (alloc_traits::propagate_on_container_swap::value) {
+      std::swap(alloc_, other.alloc_);
+    }
+    // The counters follow the storage, like for a move
+    SwapStorage(other);
+    std::swap(stats_, other.stats_);
   }
 };
 
+// Removes every element satisfying pred in one pass: the kept elements are
+// moved forward over the removed ones, then the tail is destroyed. Returns
+// the number of elements removed
+template <class T, class Allocator, class GrowthPolicy, class Predicate>
+typename vector<T, Allocator, GrowthPolicy>::size_type erase_if(
+    vector<T, Allocator, GrowthPolicy> &vec, Predicate pred) {
+  auto last = std::remove_if(vec.begin(), vec.end(), pred);
+  auto removed = static_cast<typename vector<T, Allocator,
+                                             GrowthPolicy>::size_type>(
+      vec.end() - last);
+  vec.erase(last, vec.end());
+  return removed;
+}
+
+// Removes every element equal to value, see erase_if()
+template <class T, class Allocator, class GrowthPolicy, class U>
+typename vector<T, Allocator, GrowthPolicy>::size_type erase(
+    vector<T, Allocator, GrowthPolicy> &vec, const U &value) {
+  return erase_if(vec, [&value](const T &element) {
+    return element == value;
+  });
+}
+
 }  // namespace s21
 
-#endif  // CONTAINERS_CPP_VECTOR_H
\ No newline at end of file
+#endif  // CONTAINERS_CPP_VECTOR_H
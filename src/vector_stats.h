@@ -0,0 +1,159 @@
+#ifndef CONTAINERS_CPP_VECTOR_STATS_H
+#define CONTAINERS_CPP_VECTOR_STATS_H
+
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+// Allocation and copy statistics of s21::vector. Define S21_VECTOR_STATS to
+// 1 (for the whole program) to collect them, otherwise every hook compiles
+// to nothing and adds no storage to the vector. Vectors are grouped by the
+// tag given to set_stats_tag(), S21_VECTOR_CALL_SITE makes a "file:line"
+// tag of the current line.
+#ifndef S21_VECTOR_STATS
+#define S21_VECTOR_STATS 0
+#endif
+
+#define S21_VECTOR_STRINGIZE_(x) #x
+#define S21_VECTOR_STRINGIZE(x) S21_VECTOR_STRINGIZE_(x)
+#define S21_VECTOR_CALL_SITE __FILE__ ":" S21_VECTOR_STRINGIZE(__LINE__)
+
+namespace s21 {
+
+// Counters shared by all vectors with the same tag
+struct vector_stats_record {
+  std::atomic<std::size_t> allocations{0};
+  std::atomic<std::size_t> reallocations{0};
+  std::atomic<std::size_t> bytes_relocated{0};
+  std::atomic<std::size_t> elements_shifted{0};
+  std::atomic<std::size_t> peak_capacity_bytes{0};
+  // Unused capacity of the blocks still held when vectors release them
+  std::atomic<std::size_t> wasted_capacity_bytes{0};
+};
+
+class vector_stats {
+ private:
+  struct Registry {
+    std::mutex mutex;
+    std::map<std::string, std::unique_ptr<vector_stats_record>> records;
+  };
+
+  static Registry &Instance() {
+    static Registry registry;
+    return registry;
+  }
+
+  static void WriteString(std::ostream &out, const std::string &text) {
+    out << '"';
+    for (char c : text) {
+      if (c == '"' || c == '\\') out << '\\';
+      out << c;
+    }
+    out << '"';
+  }
+
+ public:
+  static constexpr const char *kUntagged = "untagged";
+  // The record of tag, created on first use; its address stays valid
+  static vector_stats_record &record(const std::string &tag) {
+    Registry &registry = Instance();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto &slot = registry.records[tag];
+    if (!slot) slot = std::make_unique<vector_stats_record>();
+    return *slot;
+  }
+
+  static void reset() {
+    Registry &registry = Instance();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (auto &entry : registry.records) {
+      vector_stats_record &r = *entry.second;
+      r.allocations = 0;
+      r.reallocations = 0;
+      r.bytes_relocated = 0;
+      r.elements_shifted = 0;
+      r.peak_capacity_bytes = 0;
+      r.wasted_capacity_bytes = 0;
+    }
+  }
+  // Writes {"tag": {"allocations": ..., ...}, ...}
+  static void dump_json(std::ostream &out) {
+    Registry &registry = Instance();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    out << '{';
+    bool first = true;
+    for (const auto &entry : registry.records) {
+      const vector_stats_record &r = *entry.second;
+      if (!first) out << ',';
+      first = false;
+      out << "\n  ";
+      WriteString(out, entry.first);
+      out << ": {\"allocations\": " << r.allocations
+          << ", \"reallocations\": " << r.reallocations
+          << ", \"bytes_relocated\": " << r.bytes_relocated
+          << ", \"elements_shifted\": " << r.elements_shifted
+          << ", \"peak_capacity_bytes\": " << r.peak_capacity_bytes
+          << ", \"wasted_capacity_bytes\": " << r.wasted_capacity_bytes
+          << '}';
+    }
+    out << (first ? "}" : "\n}") << '\n';
+  }
+};
+
+// Per vector handle the hooks go through, the disabled one is empty
+template <bool Enabled>
+class vector_stats_handle {
+ public:
+  void set_tag(const char *) noexcept {}
+  void on_allocate(std::size_t) noexcept {}
+  void on_reallocate(std::size_t) noexcept {}
+  void on_shift(std::size_t) noexcept {}
+  void on_release(std::size_t) noexcept {}
+};
+
+template <>
+class vector_stats_handle<true> {
+ private:
+  vector_stats_record *record_ = &Untagged();
+
+  static vector_stats_record &Untagged() {
+    static vector_stats_record &untagged =
+        vector_stats::record(vector_stats::kUntagged);
+    return untagged;
+  }
+
+ public:
+  void set_tag(const char *tag) { record_ = &vector_stats::record(tag); }
+
+  void on_allocate(std::size_t bytes) noexcept {
+    record_->allocations.fetch_add(1, std::memory_order_relaxed);
+    std::size_t peak =
+        record_->peak_capacity_bytes.load(std::memory_order_relaxed);
+    while (peak < bytes && !record_->peak_capacity_bytes.compare_exchange_weak(
+                               peak, bytes, std::memory_order_relaxed)) {
+    }
+  }
+
+  void on_reallocate(std::size_t bytes_relocated) noexcept {
+    record_->reallocations.fetch_add(1, std::memory_order_relaxed);
+    record_->bytes_relocated.fetch_add(bytes_relocated,
+                                       std::memory_order_relaxed);
+  }
+
+  void on_shift(std::size_t elements) noexcept {
+    record_->elements_shifted.fetch_add(elements, std::memory_order_relaxed);
+  }
+
+  void on_release(std::size_t unused_bytes) noexcept {
+    record_->wasted_capacity_bytes.fetch_add(unused_bytes,
+                                             std::memory_order_relaxed);
+  }
+};
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_VECTOR_STATS_H